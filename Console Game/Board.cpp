@@ -0,0 +1,186 @@
+#include "Auxiliaries.h"
+#include "Exceptions.h"
+#include "Board.h"
+#include "Character.h"
+#include "CharacterPool.h"
+#include "TreeBoard.h"
+#include "HashBoard.h"
+#include "DenseBoard.h"
+#include "ChunkedBoard.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace mtm
+{
+    static const long long DENSE_CELLS_LIMIT = 1 << 16;
+    static const int DENSE_OCCUPANCY_RATIO = 8;
+
+    Board::Board(int height, int width, CharacterPool &characters)
+        : team_count{0, 0}, height(height), width(width), count(0), characters(&characters) {}
+
+    int Board::teamIndex(Team team)
+    {
+        return team == Team::POWERLIFTERS ? 0 : 1;
+    }
+
+    std::shared_ptr<Board> Board::makeBoard(BoardStorage storage, int height, int width, CharacterPool &characters)
+    {
+        if (storage == BoardStorage::AUTO)
+        {
+            storage = preferredStorage(height, width, 0);
+        }
+        std::shared_ptr<Board> board;
+        switch (storage)
+        {
+        case (BoardStorage::TREE):
+            board = std::shared_ptr<Board>(new TreeBoard(height, width, characters));
+            break;
+        case (BoardStorage::HASH):
+            board = std::shared_ptr<Board>(new HashBoard(height, width, characters));
+            break;
+        case (BoardStorage::DENSE):
+            board = std::shared_ptr<Board>(new DenseBoard(height, width, characters));
+            break;
+        case (BoardStorage::CHUNKED):
+            board = std::shared_ptr<Board>(new ChunkedBoard(height, width, characters));
+            break;
+        default:
+            throw IllegalArgument();
+            break;
+        }
+        return board;
+    }
+
+    BoardStorage Board::preferredStorage(int height, int width, int characters)
+    {
+        long long cells = (long long)height * width;
+        if (cells <= DENSE_CELLS_LIMIT || (long long)characters * DENSE_OCCUPANCY_RATIO >= cells)
+        {
+            return BoardStorage::DENSE;
+        }
+        return BoardStorage::HASH;
+    }
+
+    std::shared_ptr<Board> Board::clone(CharacterPool &characters) const
+    {
+        std::shared_ptr<Board> copy = makeBoard(getStorage(), height, width, characters);
+        forEach([&copy](const GridPoint &coordinates, CharacterHandle character)
+                { copy->insert(coordinates, character); });
+        return copy;
+    }
+
+    std::shared_ptr<Board> Board::convert(BoardStorage storage) const
+    {
+        std::shared_ptr<Board> converted = makeBoard(storage, height, width, *characters);
+        forEach([&converted](const GridPoint &coordinates, CharacterHandle character)
+                { converted->insert(coordinates, character); });
+        return converted;
+    }
+
+    int Board::getHeight() const
+    {
+        return height;
+    }
+
+    int Board::getWidth() const
+    {
+        return width;
+    }
+
+    int Board::size() const
+    {
+        return count;
+    }
+
+    int Board::teamSize(Team team) const
+    {
+        return team_count[teamIndex(team)];
+    }
+
+    bool Board::teamCountersMatch() const
+    {
+        int scanned[2] = {0, 0};
+        forEach([&scanned](const GridPoint &, CharacterHandle character)
+                { scanned[teamIndex(CharacterPool::teamOf(character))]++; });
+        return scanned[0] == team_count[0] && scanned[1] == team_count[1] && scanned[0] + scanned[1] == count;
+    }
+
+    bool Board::contains(const GridPoint &coordinates) const
+    {
+        return coordinates.row >= 0 && coordinates.row < height && coordinates.col >= 0 && coordinates.col < width;
+    }
+
+    bool Board::isEmpty(const GridPoint &coordinates) const
+    {
+        return at(coordinates) == NO_CHARACTER;
+    }
+
+    Character *Board::characterAt(const GridPoint &coordinates) const
+    {
+        CharacterHandle character = at(coordinates);
+        return character == NO_CHARACTER ? nullptr : &characters->get(character);
+    }
+
+    void Board::insert(const GridPoint &coordinates, CharacterHandle character)
+    {
+        team_count[teamIndex(CharacterPool::teamOf(character))]++;
+        count++;
+        insertCell(coordinates, character);
+    }
+
+    void Board::erase(const GridPoint &coordinates)
+    {
+        CharacterHandle character = at(coordinates);
+        if (character == NO_CHARACTER)
+        {
+            return;
+        }
+        team_count[teamIndex(CharacterPool::teamOf(character))]--;
+        count--;
+        eraseCell(coordinates);
+        characters->release(character);
+    }
+
+    void Board::probeInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const
+    {
+        int first_row = std::max(0, center.row - radius);
+        int last_row = std::min(height - 1, center.row + radius);
+        for (int i = first_row; i <= last_row; ++i)
+        {
+            int reach = radius - std::abs(i - center.row);
+            int last_col = std::min(width - 1, center.col + reach);
+            for (int j = std::max(0, center.col - reach); j <= last_col; ++j)
+            {
+                GridPoint current(i, j);
+                if (!isEmpty(current))
+                {
+                    found.push_back(current);
+                }
+            }
+        }
+    }
+
+    void Board::findInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const
+    {
+        if (radius < 0)
+        {
+            return;
+        }
+        long long cells_in_range = 2 * (long long)radius * radius + 2 * (long long)radius + 1;
+        if (cells_in_range <= count)
+        {
+            probeInRange(center, radius, found);
+            return;
+        }
+        forEach([&](const GridPoint &coordinates, CharacterHandle)
+                {
+                    if (GridPoint::distance(center, coordinates) <= radius)
+                    {
+                        found.push_back(coordinates);
+                    }
+                });
+    }
+}
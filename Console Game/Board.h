@@ -0,0 +1,183 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include "Auxiliaries.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace mtm
+{
+    class Character;
+    class CharacterPool;
+
+    /**
+     * @brief compact refrence to a character in the CharacterPool of its game (see CharacterPool).
+     */
+    typedef std::uint32_t CharacterHandle;
+    /**
+     * @brief the handle of an empty cell.
+     */
+    static const CharacterHandle NO_CHARACTER = 0;
+
+    /**
+     * @brief the way a board keeps its cells in memory.
+     * TREE - ordered map of the occupied cells.
+     * HASH - hash map of the occupied cells keyed by the packed row/col.
+     * DENSE - row-major array of all the board cells.
+     * CHUNKED - square tiles of cells, allocated only where there are characters.
+     * AUTO - let the game choose by the board size and the number of characters on it.
+     */
+    enum class BoardStorage
+    {
+        AUTO,
+        TREE,
+        HASH,
+        DENSE,
+        CHUNKED
+    };
+
+    class Board
+    {
+        int team_count[2];
+
+        /**
+         * @return index of the team in team_count.
+         */
+        static int teamIndex(Team team);
+
+    protected:
+        int height, width;
+        int count;
+        CharacterPool *characters;
+
+        /**
+         * @brief finds the occupied cells within the radius by checking every board cell in the radius.
+         * costs about 2 * radius^2 cell lookups.
+         */
+        void probeInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const;
+        /**
+         * @brief interface function to put the character in the given empty cell (called by insert).
+         */
+        virtual void insertCell(const GridPoint &coordinates, CharacterHandle character) = 0;
+        /**
+         * @brief interface function to remove the character in the given occupied cell (called by erase).
+         */
+        virtual void eraseCell(const GridPoint &coordinates) = 0;
+
+    public:
+        /**
+         * @brief visitor called by forEach with the coordinates and the character of an occupied cell.
+         */
+        typedef std::function<void(const GridPoint &, CharacterHandle)> Visitor;
+
+        /**
+         * @brief create empty board with the given dimentions.
+         * @param characters the pool of the characters that will be on the board, must outlive the board.
+         */
+        Board(int height, int width, CharacterPool &characters);
+        Board(const Board &) = default;
+        Board &operator=(const Board &) = default;
+        virtual ~Board() = default;
+
+        /**
+         * @brief static method to create an empty board with the given storage.
+         * @param storage the board storage, AUTO is resolved with preferredStorage.
+         * @param characters the pool of the characters that will be on the board.
+         * @return shared_ptr of the board created.
+         */
+        static std::shared_ptr<Board> makeBoard(BoardStorage storage, int height, int width,
+                                                CharacterPool &characters);
+        /**
+         * @brief chooses the storage that fits a board with the given dimentions and number of characters.
+         * small or crowded boards are DENSE, big and sparse boards are HASH.
+         * @return DENSE or HASH
+         */
+        static BoardStorage preferredStorage(int height, int width, int characters);
+
+        /**
+         * @brief clone "c`tor" of the board, with the same handles in the same cells.
+         * @param characters copy of the pool of this board, where the handles refer to the copied characters.
+         * @return shared_ptr of the board copy, with the same storage.
+         */
+        std::shared_ptr<Board> clone(CharacterPool &characters) const;
+        /**
+         * @brief creates a board with another storage and moves all the characters to it (same pool).
+         * @param storage the new board storage.
+         * @return shared_ptr of the new board.
+         */
+        std::shared_ptr<Board> convert(BoardStorage storage) const;
+
+        int getHeight() const;
+        int getWidth() const;
+        /**
+         * @return number of characters on the board.
+         */
+        int size() const;
+        /**
+         * @return number of characters from the given team on the board.
+         */
+        int teamSize(Team team) const;
+        /**
+         * @brief debug check that the team counters match a full scan of the board.
+         * @return true if every team counter equals the number of its characters on the board.
+         */
+        bool teamCountersMatch() const;
+        /**
+         * @brief checks if the coordinates are inside the board.
+         * @return true if inside, false if not.
+         */
+        bool contains(const GridPoint &coordinates) const;
+        /**
+         * @brief checks if a cell has no character in it. the coordinates must be inside the board.
+         * @return true if the cell is empty, false if not.
+         */
+        bool isEmpty(const GridPoint &coordinates) const;
+
+        /**
+         * @brief interface getter of the storage the board uses.
+         */
+        virtual BoardStorage getStorage() const = 0;
+        /**
+         * @brief interface access to the character in the given cell. the coordinates must be inside the board.
+         * @return handle of the cell`s character (NO_CHARACTER if the cell is empty).
+         */
+        virtual CharacterHandle at(const GridPoint &coordinates) const = 0;
+        /**
+         * @brief the character in the given cell. the coordinates must be inside the board.
+         * @return pointer to the character in the pool (nullptr if the cell is empty), valid until it is erased.
+         */
+        Character *characterAt(const GridPoint &coordinates) const;
+        /**
+         * @brief puts the character in the given cell and counts it in its team, the cell must be empty.
+         */
+        void insert(const GridPoint &coordinates, CharacterHandle character);
+        /**
+         * @brief removes the character in the given cell (if there is one) from the board and from its team count,
+         * and releases it from the pool.
+         */
+        void erase(const GridPoint &coordinates);
+
+        /**
+         * @brief interface function to move the character from src_coordinates to the empty dst_coordinates cell.
+         */
+        virtual void move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) = 0;
+        /**
+         * @brief interface function to call the visitor on every occupied cell of the board.
+         * the order of the cells depends on the storage. the board must not be changed by the visitor.
+         */
+        virtual void forEach(const Visitor &visitor) const = 0;
+        /**
+         * @brief spatial query, adds to found the coordinates of every occupied cell within radius
+         * (by GridPoint::distance) from center, including center itself.
+         * the default checks the cells in the radius, or scans the characters when there are less of them.
+         * @param center the coordinates to search around, must be inside the board.
+         * @param radius max distance from center (negative radius finds nothing).
+         * @param found vector to add the coordinates to, in no particular order.
+         */
+        virtual void findInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const;
+    };
+}
+#endif
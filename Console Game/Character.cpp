@@ -42,11 +42,12 @@ namespace mtm
   {
     return length <= movement_range;
   }
-  void Character::attackInRange(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+  GameStatus Character::attackInRange(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
   {
     if (GridPoint::distance(dst_coordinates, src_coordinates) > range)
     {
-      throw OutOfRange();
+      return GameStatus::OUT_OF_RANGE;
     }
+    return GameStatus::SUCCESS;
   }
 }
\ No newline at end of file
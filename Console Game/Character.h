@@ -1,26 +1,14 @@
 #ifndef CHARACTER_H
 #define CHARACTER_H
 
-#include <map>
 #include <memory>
 
 #include "Auxiliaries.h"
+#include "Exceptions.h"
+#include "Board.h"
 
 namespace mtm
 {
-    struct classcomp
-    {
-        /**
-         * @brief compare function between 2 gridpoints, used by the map
-         * actring as a < operator
-         * @return true if g1<g2 (comes before him on the board)
-         */
-        bool operator()(const GridPoint &g1, const GridPoint &g2) const
-        {
-            return (g1.row == g2.row) ? g1.col < g2.col : g1.row < g2.row;
-        }
-    };
-
     class Character
     {
     protected:
@@ -58,20 +46,20 @@ namespace mtm
          */
         virtual std::shared_ptr<Character> clone() const = 0;
         /**
-         * @brief interface attack function
+         * @brief interface attack function, the board and the characters are changed only on SUCCESS.
          * @param board refrence to the game board.
          * @param src_coordinates attacking character`s cords
          * @param dst_coordinates attacked character`s cords
-         * @exception detailed in each characters h file.
+         * @return SUCCESS, or the failure status detailed in each characters h file.
          */
-        virtual void attack(std::map<GridPoint, std::shared_ptr<Character>, classcomp> &board, const GridPoint &src_coordinates, const GridPoint &dst_coordinates) = 0;
+        virtual GameStatus attack(Board &board, const GridPoint &src_coordinates, const GridPoint &dst_coordinates) = 0;
         /**
          * @brief aux function to validate the attack is in a legal range
          * @param src_coordinates attacking character`s cords
          * @param dst_coordinates attacked character`s cords
-         * @exception OutOfRange if the coords are not in a legal range.
+         * @return OUT_OF_RANGE if the coords are not in a legal range, SUCCESS otherwise.
          */
-        virtual void attackInRange(const GridPoint &src_coordinates, const GridPoint &dst_coordinates);
+        virtual GameStatus attackInRange(const GridPoint &src_coordinates, const GridPoint &dst_coordinates);
         /**
          * @brief interface getter for the character`s type (SOLDIER/SNIPER/MEDIC)
          * @return enum CharacterType: SOLDIER/SNIPER/MEDIC
@@ -101,6 +89,8 @@ namespace mtm
         bool legalMove(int length);
 
         friend class Game;
+        friend class Board;
+        friend class CharacterPool;
     };
 }
 #endif
\ No newline at end of file
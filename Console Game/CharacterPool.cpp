@@ -0,0 +1,67 @@
+#include "Auxiliaries.h"
+#include "Exceptions.h"
+#include "CharacterPool.h"
+
+#include <cstdint>
+
+namespace mtm
+{
+    CharacterHandle CharacterPool::makeHandle(CharacterType type, Team team, std::uint32_t slot)
+    {
+        return ((CharacterHandle)((int)type + 1) << TYPE_SHIFT) | ((CharacterHandle)(team == Team::CROSSFITTERS) << TEAM_SHIFT) | slot;
+    }
+
+    CharacterHandle CharacterPool::add(Character &character)
+    {
+        switch (character.getType())
+        {
+        case (CharacterType::SOLDIER):
+            return makeHandle(CharacterType::SOLDIER, character.team, soldiers.add(static_cast<Soldier &>(character)));
+        case (CharacterType::MEDIC):
+            return makeHandle(CharacterType::MEDIC, character.team, medics.add(static_cast<Medic &>(character)));
+        case (CharacterType::SNIPER):
+            return makeHandle(CharacterType::SNIPER, character.team, snipers.add(static_cast<Sniper &>(character)));
+        default:
+            throw IllegalArgument();
+        }
+    }
+
+    Character &CharacterPool::get(CharacterHandle handle) const
+    {
+        switch (typeOf(handle))
+        {
+        case (CharacterType::SOLDIER):
+            return soldiers.get(handle & SLOT_MASK);
+        case (CharacterType::MEDIC):
+            return medics.get(handle & SLOT_MASK);
+        default:
+            return snipers.get(handle & SLOT_MASK);
+        }
+    }
+
+    void CharacterPool::release(CharacterHandle handle)
+    {
+        switch (typeOf(handle))
+        {
+        case (CharacterType::SOLDIER):
+            soldiers.release(handle & SLOT_MASK);
+            break;
+        case (CharacterType::MEDIC):
+            medics.release(handle & SLOT_MASK);
+            break;
+        default:
+            snipers.release(handle & SLOT_MASK);
+            break;
+        }
+    }
+
+    CharacterType CharacterPool::typeOf(CharacterHandle handle)
+    {
+        return (CharacterType)((handle >> TYPE_SHIFT) - 1);
+    }
+
+    Team CharacterPool::teamOf(CharacterHandle handle)
+    {
+        return (handle >> TEAM_SHIFT) & 1 ? Team::CROSSFITTERS : Team::POWERLIFTERS;
+    }
+}
@@ -0,0 +1,185 @@
+#ifndef CHARACTER_POOL_H
+#define CHARACTER_POOL_H
+
+#include "Auxiliaries.h"
+#include "Board.h"
+#include "Character.h"
+#include "Soldier.h"
+#include "Medic.h"
+#include "Sniper.h"
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mtm
+{
+    /**
+     * @brief slots of characters of a single type, allocated CHUNK_SIZE at a time.
+     * a character keeps its slot (and address) until it is released, released slots are reused first.
+     */
+    template <class T>
+    class TypedPool
+    {
+        static const std::uint32_t CHUNK_SIZE = 64;
+
+        struct Chunk
+        {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type slots[CHUNK_SIZE];
+        };
+
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        std::vector<bool> used;
+        std::vector<std::uint32_t> free_slots;
+
+        T *address(std::uint32_t slot) const
+        {
+            return reinterpret_cast<T *>(&chunks[slot / CHUNK_SIZE]->slots[slot % CHUNK_SIZE]);
+        }
+
+    public:
+        TypedPool() = default;
+        /**
+         * @brief copy c`tor, every character is copied to the same slot so handles stay valid in the copy.
+         * if copying a character throws, the characters copied so far are destroyed (the d`tor doesnt run
+         * for a pool that wasnt fully constructed).
+         */
+        TypedPool(const TypedPool<T> &other) : used(other.used.size(), false), free_slots(other.free_slots)
+        {
+            for (std::size_t i = 0; i < other.chunks.size(); ++i)
+            {
+                chunks.push_back(std::unique_ptr<Chunk>(new Chunk()));
+            }
+            std::uint32_t slot = 0;
+            try
+            {
+                for (; slot < other.used.size(); ++slot)
+                {
+                    if (other.used[slot])
+                    {
+                        new (address(slot)) T(*other.address(slot));
+                        used[slot] = true;
+                    }
+                }
+            }
+            catch (...)
+            {
+                while (slot > 0)
+                {
+                    if (used[--slot])
+                    {
+                        address(slot)->~T();
+                    }
+                }
+                chunks.clear();
+                throw;
+            }
+        }
+        TypedPool<T> &operator=(const TypedPool<T> &other)
+        {
+            TypedPool<T> copy(other);
+            std::swap(chunks, copy.chunks);
+            std::swap(used, copy.used);
+            std::swap(free_slots, copy.free_slots);
+            return *this;
+        }
+        ~TypedPool()
+        {
+            for (std::uint32_t slot = 0; slot < used.size(); ++slot)
+            {
+                if (used[slot])
+                {
+                    address(slot)->~T();
+                }
+            }
+        }
+
+        /**
+         * @brief copies the character into a free slot.
+         * @return the slot of the copy.
+         */
+        std::uint32_t add(const T &character)
+        {
+            std::uint32_t slot;
+            if (free_slots.empty())
+            {
+                slot = (std::uint32_t)used.size();
+                if (slot % CHUNK_SIZE == 0)
+                {
+                    chunks.push_back(std::unique_ptr<Chunk>(new Chunk()));
+                }
+                used.push_back(false);
+            }
+            else
+            {
+                slot = free_slots.back();
+                free_slots.pop_back();
+            }
+            new (address(slot)) T(character);
+            used[slot] = true;
+            return slot;
+        }
+        T &get(std::uint32_t slot) const
+        {
+            return *address(slot);
+        }
+        /**
+         * @brief destroys the character in the slot and frees the slot.
+         */
+        void release(std::uint32_t slot)
+        {
+            address(slot)->~T();
+            used[slot] = false;
+            free_slots.push_back(slot);
+        }
+    };
+
+    /**
+     * @brief the characters of a game, one TypedPool per character type.
+     * a character is referred to by a CharacterHandle of 32 bits: its type + 1 in the top 2 bits
+     * (so NO_CHARACTER is 0), its team in the next bit and its slot in the pool of its type in the rest.
+     * the type and the team can be read from the handle without touching the character.
+     */
+    class CharacterPool
+    {
+        static const int TYPE_SHIFT = 30;
+        static const int TEAM_SHIFT = 29;
+        static const CharacterHandle SLOT_MASK = (1u << TEAM_SHIFT) - 1;
+
+        TypedPool<Soldier> soldiers;
+        TypedPool<Medic> medics;
+        TypedPool<Sniper> snipers;
+
+        static CharacterHandle makeHandle(CharacterType type, Team team, std::uint32_t slot);
+
+    public:
+        CharacterPool() = default;
+        /**
+         * @brief copy c`tor, the copies of the characters have the same handles.
+         */
+        CharacterPool(const CharacterPool &) = default;
+        CharacterPool &operator=(const CharacterPool &) = default;
+        ~CharacterPool() = default;
+
+        /**
+         * @brief copies the character into the pool of its type.
+         * @return the handle of the copy.
+         */
+        CharacterHandle add(Character &character);
+        /**
+         * @return refrence to the character of the handle, the handle must not be NO_CHARACTER.
+         */
+        Character &get(CharacterHandle handle) const;
+        /**
+         * @brief destroys the character of the handle, the handle is not valid anymore.
+         */
+        void release(CharacterHandle handle);
+
+        static CharacterType typeOf(CharacterHandle handle);
+        static Team teamOf(CharacterHandle handle);
+    };
+}
+#endif
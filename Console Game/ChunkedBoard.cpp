@@ -0,0 +1,113 @@
+#include "Auxiliaries.h"
+#include "Board.h"
+#include "ChunkedBoard.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace mtm
+{
+    ChunkedBoard::ChunkedBoard(int height, int width, CharacterPool &characters)
+        : Board(height, width, characters), tiles_per_row((width + TILE_SIZE - 1) >> TILE_SHIFT),
+          tiles((std::size_t)((height + TILE_SIZE - 1) >> TILE_SHIFT) * tiles_per_row) {}
+
+    int ChunkedBoard::tileIndex(const GridPoint &coordinates) const
+    {
+        return (coordinates.row >> TILE_SHIFT) * tiles_per_row + (coordinates.col >> TILE_SHIFT);
+    }
+
+    int ChunkedBoard::cellIndex(const GridPoint &coordinates)
+    {
+        return ((coordinates.row & (TILE_SIZE - 1)) << TILE_SHIFT) | (coordinates.col & (TILE_SIZE - 1));
+    }
+
+    BoardStorage ChunkedBoard::getStorage() const
+    {
+        return BoardStorage::CHUNKED;
+    }
+
+    CharacterHandle ChunkedBoard::at(const GridPoint &coordinates) const
+    {
+        const std::unique_ptr<Tile> &tile = tiles[tileIndex(coordinates)];
+        return tile == nullptr ? NO_CHARACTER : tile->cells[cellIndex(coordinates)];
+    }
+
+    void ChunkedBoard::insertCell(const GridPoint &coordinates, CharacterHandle character)
+    {
+        std::unique_ptr<Tile> &tile = tiles[tileIndex(coordinates)];
+        if (tile == nullptr)
+        {
+            tile.reset(new Tile());
+        }
+        tile->cells[cellIndex(coordinates)] = character;
+        tile->count++;
+    }
+
+    void ChunkedBoard::eraseCell(const GridPoint &coordinates)
+    {
+        std::unique_ptr<Tile> &tile = tiles[tileIndex(coordinates)];
+        tile->cells[cellIndex(coordinates)] = NO_CHARACTER;
+        if (--tile->count == 0)
+        {
+            tile.reset();
+        }
+    }
+
+    void ChunkedBoard::move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    {
+        CharacterHandle character = at(src_coordinates);
+        eraseCell(src_coordinates);
+        insertCell(dst_coordinates, character);
+    }
+
+    void ChunkedBoard::forEach(const Visitor &visitor) const
+    {
+        for (std::size_t t = 0; t < tiles.size(); ++t)
+        {
+            if (tiles[t] == nullptr)
+            {
+                continue;
+            }
+            int row = (int)(t / tiles_per_row) << TILE_SHIFT;
+            int col = (int)(t % tiles_per_row) << TILE_SHIFT;
+            for (int c = 0; c < TILE_SIZE * TILE_SIZE; ++c)
+            {
+                if (tiles[t]->cells[c] != NO_CHARACTER)
+                {
+                    visitor(GridPoint(row + (c >> TILE_SHIFT), col + (c & (TILE_SIZE - 1))), tiles[t]->cells[c]);
+                }
+            }
+        }
+    }
+
+    void ChunkedBoard::findInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const
+    {
+        if (radius < 0)
+        {
+            return;
+        }
+        int first_row = std::max(0, center.row - radius), last_row = std::min(height - 1, center.row + radius);
+        int first_col = std::max(0, center.col - radius), last_col = std::min(width - 1, center.col + radius);
+        for (int tile_row = first_row >> TILE_SHIFT; tile_row <= last_row >> TILE_SHIFT; ++tile_row)
+        {
+            for (int tile_col = first_col >> TILE_SHIFT; tile_col <= last_col >> TILE_SHIFT; ++tile_col)
+            {
+                const std::unique_ptr<Tile> &tile = tiles[tile_row * tiles_per_row + tile_col];
+                if (tile == nullptr)
+                {
+                    continue;
+                }
+                for (int c = 0; c < TILE_SIZE * TILE_SIZE; ++c)
+                {
+                    GridPoint current((tile_row << TILE_SHIFT) + (c >> TILE_SHIFT), (tile_col << TILE_SHIFT) + (c & (TILE_SIZE - 1)));
+                    if (tile->cells[c] != NO_CHARACTER && GridPoint::distance(center, current) <= radius)
+                    {
+                        found.push_back(current);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef CHUNKED_BOARD_H
+#define CHUNKED_BOARD_H
+
+#include "Auxiliaries.h"
+#include "Board.h"
+
+#include <memory>
+#include <vector>
+
+namespace mtm
+{
+    class ChunkedBoard : public Board
+    {
+        static const int TILE_SHIFT = 4;
+        static const int TILE_SIZE = 1 << TILE_SHIFT;
+
+        struct Tile
+        {
+            CharacterHandle cells[TILE_SIZE * TILE_SIZE];
+            int count;
+            Tile() : cells(), count(0) {}
+        };
+
+        int tiles_per_row;
+        std::vector<std::unique_ptr<Tile>> tiles;
+
+        /**
+         * @return index of the tile containing the coordinates in the tiles array.
+         */
+        int tileIndex(const GridPoint &coordinates) const;
+        /**
+         * @return index of the coordinates inside their tile.
+         */
+        static int cellIndex(const GridPoint &coordinates);
+
+    protected:
+        void insertCell(const GridPoint &coordinates, CharacterHandle character) override;
+        void eraseCell(const GridPoint &coordinates) override;
+
+    public:
+        /**
+         * @brief create empty board split to TILE_SIZE * TILE_SIZE tiles,
+         * a tile is allocated only while there are characters in it.
+         */
+        ChunkedBoard(int height, int width, CharacterPool &characters);
+        ChunkedBoard(const ChunkedBoard &) = delete;
+        ChunkedBoard &operator=(const ChunkedBoard &) = delete;
+        ChunkedBoard() = delete;
+        ~ChunkedBoard() = default;
+
+        BoardStorage getStorage() const override;
+        CharacterHandle at(const GridPoint &coordinates) const override;
+        void move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
+        /**
+         * @brief visits the occupied cells tile by tile, in row-major order inside each tile.
+         */
+        void forEach(const Visitor &visitor) const override;
+        /**
+         * @brief checks only the allocated tiles that intersect the radius.
+         */
+        void findInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const override;
+    };
+}
+#endif
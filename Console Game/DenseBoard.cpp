@@ -0,0 +1,75 @@
+#include "Auxiliaries.h"
+#include "Exceptions.h"
+#include "Board.h"
+#include "DenseBoard.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace mtm
+{
+    DenseBoard::DenseBoard(int height, int width, CharacterPool &characters)
+        : Board(height, width, characters)
+    {
+        if ((unsigned long long)height * width > cells.max_size())
+        {
+            throw IllegalArgument();
+        }
+        cells.resize((std::size_t)height * width);
+    }
+
+    std::size_t DenseBoard::index(const GridPoint &coordinates) const
+    {
+        return (std::size_t)coordinates.row * width + coordinates.col;
+    }
+
+    BoardStorage DenseBoard::getStorage() const
+    {
+        return BoardStorage::DENSE;
+    }
+
+    CharacterHandle DenseBoard::at(const GridPoint &coordinates) const
+    {
+        return cells[index(coordinates)];
+    }
+
+    void DenseBoard::insertCell(const GridPoint &coordinates, CharacterHandle character)
+    {
+        cells[index(coordinates)] = character;
+    }
+
+    void DenseBoard::eraseCell(const GridPoint &coordinates)
+    {
+        cells[index(coordinates)] = NO_CHARACTER;
+    }
+
+    void DenseBoard::move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    {
+        std::swap(cells[index(dst_coordinates)], cells[index(src_coordinates)]);
+    }
+
+    void DenseBoard::forEach(const Visitor &visitor) const
+    {
+        for (int i = 0; i < height; ++i)
+        {
+            std::size_t row_start = (std::size_t)i * width;
+            for (int j = 0; j < width; ++j)
+            {
+                CharacterHandle character = cells[row_start + j];
+                if (character != NO_CHARACTER)
+                {
+                    visitor(GridPoint(i, j), character);
+                }
+            }
+        }
+    }
+
+    void DenseBoard::findInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const
+    {
+        if (radius >= 0)
+        {
+            probeInRange(center, radius, found);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef DENSE_BOARD_H
+#define DENSE_BOARD_H
+
+#include "Auxiliaries.h"
+#include "Board.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace mtm
+{
+    class DenseBoard : public Board
+    {
+        std::vector<CharacterHandle> cells;
+
+        /**
+         * @brief converts coordinates to the cell`s index in the row-major cells array.
+         * @return row * width + col, computed in std::size_t so big boards dont overflow
+         */
+        std::size_t index(const GridPoint &coordinates) const;
+
+    protected:
+        void insertCell(const GridPoint &coordinates, CharacterHandle character) override;
+        void eraseCell(const GridPoint &coordinates) override;
+
+    public:
+        /**
+         * @brief create board of height * width empty cells in one row-major array.
+         * @exception IllegalArgument if the array doesnt fit in the memory that can be addressed.
+         */
+        DenseBoard(int height, int width, CharacterPool &characters);
+        DenseBoard(const DenseBoard &) = default;
+        DenseBoard() = delete;
+        ~DenseBoard() = default;
+
+        BoardStorage getStorage() const override;
+        CharacterHandle at(const GridPoint &coordinates) const override;
+        void move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
+        /**
+         * @brief visits the occupied cells in row-major order.
+         */
+        void forEach(const Visitor &visitor) const override;
+        /**
+         * @brief checks the cells in the radius directly in the array.
+         */
+        void findInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const override;
+    };
+}
+#endif
@@ -1,27 +1,54 @@
 #include "Exceptions.h"
-#include <string>
-#include <cstring>
-#include <stdexcept>
 
 namespace mtm
 {
-    Exception::Exception(std::string name)
-    {
-        std::string msg_s = "A game related error has occurred: " + name;
-        msg = new char[msg_s.length() + 1];
-        strcpy(msg, msg_s.c_str());
-    }
+    static const char ILLEGAL_ARGUMENT_MSG[] = "A game related error has occurred: IllegalArgument";
+    static const char ILLEGAL_CELL_MSG[] = "A game related error has occurred: IllegalCell";
+    static const char CELL_EMPTY_MSG[] = "A game related error has occurred: CellEmpty";
+    static const char MOVE_TOO_FAR_MSG[] = "A game related error has occurred: MoveTooFar";
+    static const char CELL_OCCUPIED_MSG[] = "A game related error has occurred: CellOccupied";
+    static const char OUT_OF_RANGE_MSG[] = "A game related error has occurred: OutOfRange";
+    static const char OUT_OF_AMMO_MSG[] = "A game related error has occurred: OutOfAmmo";
+    static const char ILLEGAL_TARGET_MSG[] = "A game related error has occurred: IllegalTarget";
+
+    Exception::Exception(const char *msg) noexcept : msg(msg) {}
+
     const char *Exception::what() const noexcept
     {
         return msg;
     }
 
-    IllegalArgument::IllegalArgument() : Exception("IllegalArgument") {}
-    IllegalCell::IllegalCell() : Exception("IllegalCell") {}
-    CellEmpty::CellEmpty() : Exception("CellEmpty") {}
-    MoveTooFar::MoveTooFar() : Exception("MoveTooFar") {}
-    CellOccupied::CellOccupied() : Exception("CellOccupied") {}
-    OutOfRange::OutOfRange() : Exception("OutOfRange") {}
-    OutOfAmmo::OutOfAmmo() : Exception("OutOfAmmo") {}
-    IllegalTarget::IllegalTarget() : Exception("IllegalTarget") {}
+    IllegalArgument::IllegalArgument() noexcept : Exception(ILLEGAL_ARGUMENT_MSG) {}
+    IllegalCell::IllegalCell() noexcept : Exception(ILLEGAL_CELL_MSG) {}
+    CellEmpty::CellEmpty() noexcept : Exception(CELL_EMPTY_MSG) {}
+    MoveTooFar::MoveTooFar() noexcept : Exception(MOVE_TOO_FAR_MSG) {}
+    CellOccupied::CellOccupied() noexcept : Exception(CELL_OCCUPIED_MSG) {}
+    OutOfRange::OutOfRange() noexcept : Exception(OUT_OF_RANGE_MSG) {}
+    OutOfAmmo::OutOfAmmo() noexcept : Exception(OUT_OF_AMMO_MSG) {}
+    IllegalTarget::IllegalTarget() noexcept : Exception(ILLEGAL_TARGET_MSG) {}
+
+    void throwIfFailed(GameStatus status)
+    {
+        switch (status)
+        {
+        case (GameStatus::SUCCESS):
+            break;
+        case (GameStatus::ILLEGAL_ARGUMENT):
+            throw IllegalArgument();
+        case (GameStatus::ILLEGAL_CELL):
+            throw IllegalCell();
+        case (GameStatus::CELL_EMPTY):
+            throw CellEmpty();
+        case (GameStatus::MOVE_TOO_FAR):
+            throw MoveTooFar();
+        case (GameStatus::CELL_OCCUPIED):
+            throw CellOccupied();
+        case (GameStatus::OUT_OF_RANGE):
+            throw OutOfRange();
+        case (GameStatus::OUT_OF_AMMO):
+            throw OutOfAmmo();
+        case (GameStatus::ILLEGAL_TARGET):
+            throw IllegalTarget();
+        }
+    }
 }
\ No newline at end of file
@@ -2,64 +2,87 @@
 #define MTM_EXCEPTIONS_H
 
 #include <exception>
-#include <stdexcept>
-#include <string>
 namespace mtm
 {
+    /**
+     * @brief result of a game action: SUCCESS, or the rule it broke (one status per exception type).
+     */
+    enum class GameStatus : unsigned char
+    {
+        SUCCESS,
+        ILLEGAL_ARGUMENT,
+        ILLEGAL_CELL,
+        CELL_EMPTY,
+        MOVE_TOO_FAR,
+        CELL_OCCUPIED,
+        OUT_OF_RANGE,
+        OUT_OF_AMMO,
+        ILLEGAL_TARGET
+    };
+
     class Exception : public std::exception
     {
+        const char *msg;
+
+    protected:
+        /**
+         * @brief c`tor for the exception types, never allocates.
+         * @param msg static message returned by what(), it is not copied or freed.
+         */
+        explicit Exception(const char *msg) noexcept;
+
     public:
-        Exception(std::string name);
-        ~Exception() noexcept
-        {
-            if(msg != nullptr)
-            {
-                delete[] msg;
-            }
-        }
-        virtual const char *what() const noexcept;
-        char *msg;
+        Exception(const Exception &) = default;
+        Exception &operator=(const Exception &) = default;
+        ~Exception() = default;
+        virtual const char *what() const noexcept override;
     };
 
     class IllegalArgument : public Exception
     {
     public:
-        explicit IllegalArgument();
+        explicit IllegalArgument() noexcept;
     };
     class IllegalCell : public Exception
     {
     public:
-        explicit IllegalCell();
+        explicit IllegalCell() noexcept;
     };
     class CellEmpty : public Exception
     {
     public:
-        explicit CellEmpty();
+        explicit CellEmpty() noexcept;
     };
     class MoveTooFar : public Exception
     {
     public:
-        explicit MoveTooFar();
+        explicit MoveTooFar() noexcept;
     };
     class CellOccupied : public Exception
     {
     public:
-        explicit CellOccupied();
+        explicit CellOccupied() noexcept;
     };
     class OutOfRange : public Exception
     {
     public:
-        explicit OutOfRange();
+        explicit OutOfRange() noexcept;
     };
     class OutOfAmmo : public Exception
     {
     public:
-        explicit OutOfAmmo();
+        explicit OutOfAmmo() noexcept;
     };
     class IllegalTarget : public Exception
     {
     public:
-        explicit IllegalTarget();
+        explicit IllegalTarget() noexcept;
     };
+
+    /**
+     * @brief throws the exception matching the status (for the throwing API wrappers).
+     * @param status result of a game action, nothing is thrown for SUCCESS.
+     */
+    void throwIfFailed(GameStatus status);
 }
 #endif
\ No newline at end of file
@@ -6,9 +6,10 @@
 #include "Sniper.h"
 #include "Medic.h"
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
-#include <map>
-#include <iterator>
+#include <vector>
 
 namespace mtm
 {
@@ -17,26 +18,19 @@ namespace mtm
     static const char MEDIC_CHAR = 'm';
     static const char EMPTY_CHAR = ' ';
 
-    Game::Game(int height, int width)
-        : height(height), width(width), board(std::map<GridPoint, std::shared_ptr<Character>, classcomp>())
+    Game::Game(int height, int width, BoardStorage storage)
+        : height(height), width(width), storage(storage), board(nullptr)
     {
         if (height <= 0 || width <= 0)
         {
             throw IllegalArgument();
         }
+        board = Board::makeBoard(storage, height, width, characters);
     }
     Game::Game(const Game &other)
-        : height(other.height), width(other.width), board(std::map<GridPoint, std::shared_ptr<Character>, classcomp>())
-    {
-        std::shared_ptr<Character> current_character, character_copy;
-        for (std::map<GridPoint, std::shared_ptr<Character>, classcomp>::const_iterator itr = other.board.begin();
-             itr != other.board.end(); ++itr)
-        {
-            current_character = itr->second;
-            character_copy = current_character->clone();
-            this->board.insert(make_pair(itr->first, character_copy));
-        }
-    }
+        : height(other.height), width(other.width), storage(other.storage), characters(other.characters),
+          board(other.board->clone(characters)) {}
+
     Game &Game::operator=(const Game &other)
     {
         if (this == &other)
@@ -45,50 +39,34 @@ namespace mtm
         }
         this->height = other.height;
         this->width = other.width;
-        this->board = std::map<GridPoint, std::shared_ptr<Character>, classcomp>();
-        std::shared_ptr<Character> current_character, character_copy;
-        for (std::map<GridPoint, std::shared_ptr<Character>, classcomp>::const_iterator itr = other.board.begin();
-             itr != other.board.end(); ++itr)
-        {
-            current_character = other.board.at(itr->first);
-            character_copy = current_character->clone();
-            this->board.insert(make_pair(itr->first, character_copy));
-        }
+        this->storage = other.storage;
+        this->characters = other.characters;
+        this->board = other.board->clone(characters);
         return *this;
     }
 
-    bool Game::cellIsEmpty(const GridPoint &coordinates)
+    void Game::addCharacter(const GridPoint &coordinates, std::shared_ptr<Character> character)
     {
-        return board.find(coordinates) == board.end();
+        throwIfFailed(tryAddCharacter(coordinates, character));
     }
 
-    void Game::checkCellInBoard(const GridPoint &coordinates)
+    GameStatus Game::tryAddCharacter(const GridPoint &coordinates, std::shared_ptr<Character> character)
     {
-        if (coordinates.row < 0 || coordinates.row >= height || coordinates.col < 0 || coordinates.col >= width)
+        if (!board->contains(coordinates))
         {
-            throw IllegalCell();
+            return GameStatus::ILLEGAL_CELL;
         }
-    }
-
-    void Game::checkCellOccupied(const GridPoint &coordinates)
-    {
-        if (!cellIsEmpty(coordinates))
+        if (!board->isEmpty(coordinates))
         {
-            throw CellOccupied();
+            return GameStatus::CELL_OCCUPIED;
         }
-    }
-    void Game::checkcellIsntEmpty(const GridPoint &coordinates)
-    {
-        if (cellIsEmpty(coordinates))
+        board->insert(coordinates, characters.add(*character));
+        if (storage == BoardStorage::AUTO && board->getStorage() != BoardStorage::DENSE &&
+            Board::preferredStorage(height, width, board->size()) == BoardStorage::DENSE)
         {
-            throw CellEmpty();
+            board = board->convert(BoardStorage::DENSE);
         }
-    }
-    void Game::addCharacter(const GridPoint &coordinates, std::shared_ptr<Character> character)
-    {
-        checkCellInBoard(coordinates);
-        checkCellOccupied(coordinates);
-        this->board.insert(make_pair(coordinates, character));
+        return GameStatus::SUCCESS;
     }
 
     std::shared_ptr<Character> Game::makeCharacter(CharacterType type, Team team,
@@ -98,13 +76,13 @@ namespace mtm
         switch (type)
         {
         case (CharacterType::SOLDIER):
-            character = std::shared_ptr<Character>(new Soldier(health, ammo, range, power, team));
+            character = std::make_shared<Soldier>(health, ammo, range, power, team);
             break;
         case (CharacterType::SNIPER):
-            character = std::shared_ptr<Character>(new Sniper(health, ammo, range, power, team));
+            character = std::make_shared<Sniper>(health, ammo, range, power, team);
             break;
         case (CharacterType::MEDIC):
-            character = std::shared_ptr<Character>(new Medic(health, ammo, range, power, team));
+            character = std::make_shared<Medic>(health, ammo, range, power, team);
             break;
         default:
             throw IllegalArgument();
@@ -115,118 +93,122 @@ namespace mtm
 
     void Game::move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
     {
-        checkCellInBoard(src_coordinates);
-        checkCellInBoard(dst_coordinates);
-        checkcellIsntEmpty(src_coordinates);
+        throwIfFailed(tryMove(src_coordinates, dst_coordinates));
+    }
 
-        std::shared_ptr<Character> tmp_character = board.at(src_coordinates);
-        if (!tmp_character->legalMove(GridPoint::distance(src_coordinates, dst_coordinates)))
+    GameStatus Game::tryMove(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    {
+        if (!board->contains(src_coordinates) || !board->contains(dst_coordinates))
         {
-            throw MoveTooFar();
+            return GameStatus::ILLEGAL_CELL;
         }
-
-        checkCellOccupied(dst_coordinates);
-        board.erase(src_coordinates);
-        board[dst_coordinates] = tmp_character;
+        Character *character = board->characterAt(src_coordinates);
+        if (character == nullptr)
+        {
+            return GameStatus::CELL_EMPTY;
+        }
+        if (!character->legalMove(GridPoint::distance(src_coordinates, dst_coordinates)))
+        {
+            return GameStatus::MOVE_TOO_FAR;
+        }
+        if (!board->isEmpty(dst_coordinates))
+        {
+            return GameStatus::CELL_OCCUPIED;
+        }
+        board->move(src_coordinates, dst_coordinates);
+        return GameStatus::SUCCESS;
     }
 
     void Game::attack(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
     {
-        checkCellInBoard(src_coordinates);
-        checkCellInBoard(dst_coordinates);
-        checkcellIsntEmpty(src_coordinates);
+        throwIfFailed(tryAttack(src_coordinates, dst_coordinates));
+    }
 
-        std::shared_ptr<Character> character = board.at(src_coordinates);
-        character->attack(board, src_coordinates, dst_coordinates);
+    GameStatus Game::tryAttack(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    {
+        if (!board->contains(src_coordinates) || !board->contains(dst_coordinates))
+        {
+            return GameStatus::ILLEGAL_CELL;
+        }
+        Character *character = board->characterAt(src_coordinates);
+        if (character == nullptr)
+        {
+            return GameStatus::CELL_EMPTY;
+        }
+        return character->attack(*board, src_coordinates, dst_coordinates);
     }
+
     void Game::reload(const GridPoint &coordinates)
     {
-        checkCellInBoard(coordinates);
-        checkcellIsntEmpty(coordinates);
-
-        std::shared_ptr<Character> character = board.at(coordinates);
-        character->reload();
+        throwIfFailed(tryReload(coordinates));
     }
-    bool Game::isOver(Team *winningTeam) const
+
+    GameStatus Game::tryReload(const GridPoint &coordinates)
     {
-        Team first_found;
-        bool found_player = false;
-        std::shared_ptr<Character> character;
-        for (std::map<GridPoint, std::shared_ptr<Character>, classcomp>::const_iterator itr = board.begin();
-             itr != board.end(); ++itr)
+        if (!board->contains(coordinates))
         {
-            character = itr->second;
-            if (!found_player)
-            {
-                found_player = true;
-                first_found = character->isEnemy(Team::CROSSFITTERS) ? Team::POWERLIFTERS : Team::CROSSFITTERS;
-            }
-            else if (found_player && character->isEnemy(first_found))
-            {
-                return false;
-            }
+            return GameStatus::ILLEGAL_CELL;
         }
-
-        if (found_player)
+        Character *character = board->characterAt(coordinates);
+        if (character == nullptr)
         {
-            if (winningTeam)
-            {
-                *winningTeam = first_found;
-            }
-            return true;
+            return GameStatus::CELL_EMPTY;
         }
-        else
+        character->reload();
+        return GameStatus::SUCCESS;
+    }
+
+    bool Game::isOver(Team *winningTeam) const
+    {
+        assert(board->teamCountersMatch());
+        int powerlifters = board->teamSize(Team::POWERLIFTERS);
+        int crossfitters = board->teamSize(Team::CROSSFITTERS);
+        if ((powerlifters > 0) == (crossfitters > 0))
         {
             return false;
         }
+        if (winningTeam)
+        {
+            *winningTeam = powerlifters > 0 ? Team::POWERLIFTERS : Team::CROSSFITTERS;
+        }
+        return true;
     }
 
-    std::string Game::toString() const
+    void Game::render(char *frame) const
     {
-        std::string output = "";
-        char current;
-        std::shared_ptr<Character> character;
-        for (int i = 0; i < height; ++i)
-        {
-            for (int j = 0; j < width; ++j)
-            {
-                try
-                {
-                    character = board.at(GridPoint(i, j));
-                    switch (character->getType())
-                    {
-                    case (CharacterType::SOLDIER):
-                        current = SOLDIER_CHAR;
-                        break;
-                    case (CharacterType::SNIPER):
-                        current = SNIPER_CHAR;
-                        break;
-                    case (CharacterType::MEDIC):
-                        current = MEDIC_CHAR;
-                        break;
-                    default:
-                        break;
-                    }
-
-                    if (character->isEnemy(Team::CROSSFITTERS))
-                    {
-                        current = toupper(current);
-                    }
-                }
-                catch (const std::out_of_range &e)
-                {
-                    current = EMPTY_CHAR;
-                }
-                output.push_back(current);
-            }
-        }
-        return output;
+        std::fill(frame, frame + (std::size_t)height * width, EMPTY_CHAR);
+        int board_width = width;
+        board->forEach([frame, board_width](const GridPoint &coordinates, CharacterHandle character)
+                       {
+                           char current = EMPTY_CHAR;
+                           switch (CharacterPool::typeOf(character))
+                           {
+                           case (CharacterType::SOLDIER):
+                               current = SOLDIER_CHAR;
+                               break;
+                           case (CharacterType::SNIPER):
+                               current = SNIPER_CHAR;
+                               break;
+                           case (CharacterType::MEDIC):
+                               current = MEDIC_CHAR;
+                               break;
+                           default:
+                               break;
+                           }
+
+                           if (CharacterPool::teamOf(character) != Team::CROSSFITTERS)
+                           {
+                               current = toupper(current);
+                           }
+                           frame[(std::size_t)coordinates.row * board_width + coordinates.col] = current;
+                       });
     }
 
     std::ostream &operator<<(std::ostream &os, const Game &game)
     {
-        std::string out = game.toString();
-        printGameBoard(os, &*out.begin(), &*out.end(), game.width);
+        std::vector<char> frame((std::size_t)game.height * game.width);
+        game.render(frame.data());
+        printGameBoard(os, frame.data(), frame.data() + frame.size(), game.width);
         return os;
     }
-}
\ No newline at end of file
+}
@@ -2,52 +2,40 @@
 #define MTM_GAME_H
 
 #include "Auxiliaries.h"
+#include "Exceptions.h"
+#include "Board.h"
 #include "Character.h"
+#include "CharacterPool.h"
 
 #include <memory>
-#include <map>
 
 namespace mtm
 {
    class Game
    {
       int height, width;
-      std::map<GridPoint, std::shared_ptr<Character>, classcomp> board;
+      BoardStorage storage;
+      CharacterPool characters;
+      std::shared_ptr<Board> board;
 
       /**
-       * @brief Validation function for checking if the coordinates are inside the board.
-       * @exception IllegalCell if the coordinates are not in board.
-       */
-      void checkCellInBoard(const GridPoint &coordinates);
-      /**
-       * @brief Validation function for checking if a cell in the board has a character in it.
-       * @exception IllegalCell if the coordinates are not inside the board.
-       */
-      void checkCellOccupied(const GridPoint &coordinates);
-      /**
-       * @brief Validation function for checking if a cell is not empty.
-       * @exception CellEmpty if the cell is empty.
-       */
-      void checkcellIsntEmpty(const GridPoint &coordinates);
-      /**
-       * @brief Validation function for checking if a cell is empty.
-       * @return true if the cell is empty, false if not.
-       */
-      bool cellIsEmpty(const GridPoint &coordinates);
-      /**
-       * @brief convert game board to string for printing purposes.
-       * @return std::string of the game with the following logic:
+       * @brief draws the game board into frame for printing purposes, in a single pass over the characters.
+       * @param frame buffer of height * width chars, filled row by row with the following logic:
        * 's' for soldier, 'n' for sniper, 'm' for medic, ' ' for empty cell.
        * if the Character is from the Powerlifters team the letter is uppercased.
        */
-      std::string toString() const;
+      void render(char *frame) const;
 
    public:
       /**
      * @brief create empty board with the given dimentions.
-     * @exception IllegalArgument if one of the dimensions is non-positive.
+     * @param storage how the board keeps its cells (see BoardStorage), with AUTO the board starts sparse
+     * on big boards and switches to DENSE once enough characters are added.
+     * @exception IllegalArgument if one of the dimensions is non-positive,
+     * or if the board has more cells than a DENSE board can index.
+     * @exception std::bad_alloc if there is no memory for the cells of a DENSE board.
      */
-      Game(int height, int width);
+      Game(int height, int width, BoardStorage storage = BoardStorage::AUTO);
       /**
        * @brief d`tor
        */
@@ -65,11 +53,17 @@ namespace mtm
       Game &operator=(const Game &other);
 
       /**
-     * @brief get character and adds it to to board with the given coordinates.
+     * @brief get character and adds a copy of it to to board with the given coordinates.
+     * the game keeps its own copy in its CharacterPool, later changes to character dont affect the game.
      * @exception IllegalCell if the coordinates are not in board.
      * @exception CellOccupied if the given coordinates are of a occupied cell.
      */
       void addCharacter(const GridPoint &coordinates, std::shared_ptr<Character> character);
+      /**
+     * @brief non-throwing addCharacter.
+     * @return SUCCESS, or ILLEGAL_CELL / CELL_OCCUPIED in the cases addCharacter throws them.
+     */
+      GameStatus tryAddCharacter(const GridPoint &coordinates, std::shared_ptr<Character> character);
 
       /**
      * @brief static methos to create a character with the given info and return a shared_ptr of it.
@@ -89,6 +83,12 @@ namespace mtm
      * @exception CellOccupied if the dst_coordinates is already occupied.
      */
       void move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates);
+      /**
+     * @brief non-throwing move, the board is changed only on SUCCESS.
+     * @return SUCCESS, or the status matching the exception move throws
+     * (ILLEGAL_CELL, CELL_EMPTY, MOVE_TOO_FAR, CELL_OCCUPIED).
+     */
+      GameStatus tryMove(const GridPoint &src_coordinates, const GridPoint &dst_coordinates);
 
       /**
      * @brief the character in src_coordinates attacks the dst_coordinates cell.
@@ -99,6 +99,12 @@ namespace mtm
      * @exception IllegalTarget if the character cant attack for any other reason (inner character logic).
      */
       void attack(const GridPoint &src_coordinates, const GridPoint &dst_coordinates);
+      /**
+     * @brief non-throwing attack, the board is changed only on SUCCESS.
+     * @return SUCCESS, or the status matching the exception attack throws
+     * (ILLEGAL_CELL, CELL_EMPTY, OUT_OF_RANGE, OUT_OF_AMMO, ILLEGAL_TARGET).
+     */
+      GameStatus tryAttack(const GridPoint &src_coordinates, const GridPoint &dst_coordinates);
 
       /**
      * @brief adds ammo to the character in coordinates.
@@ -106,9 +112,14 @@ namespace mtm
      * @exception CellEmpty if the coordinates doesnt contain a character.
      */
       void reload(const GridPoint &coordinates);
+      /**
+     * @brief non-throwing reload.
+     * @return SUCCESS, or ILLEGAL_CELL / CELL_EMPTY in the cases reload throws them.
+     */
+      GameStatus tryReload(const GridPoint &coordinates);
 
       /**
-     * @brief checks the board for a victory.
+     * @brief checks the board for a victory, in constant time by the board`s team counters.
      * @param winningTeam=NULL is changed accordingaly, if no team won this is not changed.
      * @return 
      * true if a team won (no characters left from the other team).
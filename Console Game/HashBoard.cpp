@@ -0,0 +1,60 @@
+#include "Auxiliaries.h"
+#include "Board.h"
+#include "HashBoard.h"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+namespace mtm
+{
+    HashBoard::HashBoard(int height, int width, CharacterPool &characters) : Board(height, width, characters), cells() {}
+
+    std::uint64_t HashBoard::key(const GridPoint &coordinates)
+    {
+        return ((std::uint64_t)(std::uint32_t)coordinates.row << 32) | (std::uint32_t)coordinates.col;
+    }
+
+    GridPoint HashBoard::coordinatesOf(std::uint64_t key)
+    {
+        return GridPoint((int)(std::uint32_t)(key >> 32), (int)(std::uint32_t)key);
+    }
+
+    BoardStorage HashBoard::getStorage() const
+    {
+        return BoardStorage::HASH;
+    }
+
+    CharacterHandle HashBoard::at(const GridPoint &coordinates) const
+    {
+        std::unordered_map<std::uint64_t, CharacterHandle>::const_iterator itr = cells.find(key(coordinates));
+        return itr == cells.end() ? NO_CHARACTER : itr->second;
+    }
+
+    void HashBoard::insertCell(const GridPoint &coordinates, CharacterHandle character)
+    {
+        cells.insert(std::make_pair(key(coordinates), character));
+    }
+
+    void HashBoard::eraseCell(const GridPoint &coordinates)
+    {
+        cells.erase(key(coordinates));
+    }
+
+    void HashBoard::move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    {
+        std::unordered_map<std::uint64_t, CharacterHandle>::iterator itr = cells.find(key(src_coordinates));
+        CharacterHandle character = itr->second;
+        cells.erase(itr);
+        cells.insert(std::make_pair(key(dst_coordinates), character));
+    }
+
+    void HashBoard::forEach(const Visitor &visitor) const
+    {
+        for (std::unordered_map<std::uint64_t, CharacterHandle>::const_iterator itr = cells.begin();
+             itr != cells.end(); ++itr)
+        {
+            visitor(coordinatesOf(itr->first), itr->second);
+        }
+    }
+}
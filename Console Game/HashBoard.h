@@ -0,0 +1,48 @@
+#ifndef HASH_BOARD_H
+#define HASH_BOARD_H
+
+#include "Auxiliaries.h"
+#include "Board.h"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+namespace mtm
+{
+    class HashBoard : public Board
+    {
+        std::unordered_map<std::uint64_t, CharacterHandle> cells;
+
+        /**
+         * @brief packs the coordinates to a single key: row in the high 32 bits, col in the low 32 bits.
+         */
+        static std::uint64_t key(const GridPoint &coordinates);
+        /**
+         * @brief unpacks a key made by key() back to coordinates.
+         */
+        static GridPoint coordinatesOf(std::uint64_t key);
+
+    protected:
+        void insertCell(const GridPoint &coordinates, CharacterHandle character) override;
+        void eraseCell(const GridPoint &coordinates) override;
+
+    public:
+        /**
+         * @brief create empty board that keeps only the occupied cells in a hash map.
+         */
+        HashBoard(int height, int width, CharacterPool &characters);
+        HashBoard(const HashBoard &) = default;
+        HashBoard() = delete;
+        ~HashBoard() = default;
+
+        BoardStorage getStorage() const override;
+        CharacterHandle at(const GridPoint &coordinates) const override;
+        void move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
+        /**
+         * @brief visits the occupied cells in no particular order.
+         */
+        void forEach(const Visitor &visitor) const override;
+    };
+}
+#endif
@@ -4,7 +4,6 @@
 #include "Medic.h"
 
 #include <memory>
-#include <map>
 
 namespace mtm
 {
@@ -21,26 +20,30 @@ namespace mtm
         return ptr;
     }
 
-    void Medic::attack(std::map<GridPoint, std::shared_ptr<Character>, classcomp> &board,
-                       const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    GameStatus Medic::attack(Board &board,
+                             const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
     {
-        attackInRange(src_coordinates, dst_coordinates);
+        GameStatus in_range = attackInRange(src_coordinates, dst_coordinates);
+        if (in_range != GameStatus::SUCCESS)
+        {
+            return in_range;
+        }
         if (ammo <= 0)
         {
-            throw OutOfAmmo();
+            return GameStatus::OUT_OF_AMMO;
         }
         if (src_coordinates.row == dst_coordinates.row && src_coordinates.col == dst_coordinates.col)
         {
-            throw IllegalTarget();
+            return GameStatus::ILLEGAL_TARGET;
         }
 
-        if (board.find(dst_coordinates) == board.end())
+        if (board.isEmpty(dst_coordinates))
         {
-            throw IllegalTarget();
+            return GameStatus::ILLEGAL_TARGET;
         }
         else
         {
-            std::shared_ptr<Character> target = board.at(dst_coordinates);
+            Character *target = board.characterAt(dst_coordinates);
             if (target->isEnemy(team))
             {
                 if (target->takeDamage(power))
@@ -54,6 +57,7 @@ namespace mtm
                 target->takeDamage(-power);
             }
         }
+        return GameStatus::SUCCESS;
     }
 
     CharacterType Medic::getType()
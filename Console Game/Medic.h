@@ -24,12 +24,12 @@ namespace mtm
          * @param board refrence to the game board
          * @param src_coordinates attacking character`s coords
          * @param dst_coordinates attacked character`s coords
-         * @exception OutOfAmmo if the target is an enemy and the medic dont have any ammo
-         * @exception IllegalTarget if the target is an empty cell
-         * @exception outOfRange if the target is out of range (using attackInRange aux func)
+         * @return OUT_OF_AMMO if the target is an enemy and the medic dont have any ammo
+         * @return ILLEGAL_TARGET if the target is an empty cell
+         * @return OUT_OF_RANGE if the target is out of range (using attackInRange aux func)
          */
-        void attack(std::map<GridPoint, std::shared_ptr<Character>, classcomp> &board,
-                    const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
+        GameStatus attack(Board &board,
+                          const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
         CharacterType getType() override;
     };
 }
@@ -4,7 +4,6 @@
 #include "Sniper.h"
 
 #include <memory>
-#include <map>
 #include <cmath>
 
 namespace mtm
@@ -21,35 +20,43 @@ namespace mtm
         std::shared_ptr<Character> ptr(new Sniper(*this));
         return ptr;
     }
-    void Sniper::attackInRange(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    GameStatus Sniper::attackInRange(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
     {
-        Character::attackInRange(src_coordinates, dst_coordinates);
+        if (Character::attackInRange(src_coordinates, dst_coordinates) != GameStatus::SUCCESS)
+        {
+            return GameStatus::OUT_OF_RANGE;
+        }
         int n1 = GridPoint::distance(dst_coordinates, src_coordinates);
         int n2 = (int)ceil((double)range / 2.0);
         if (n1 < n2)
         {
-            throw OutOfRange();
+            return GameStatus::OUT_OF_RANGE;
         }
+        return GameStatus::SUCCESS;
     }
-    void Sniper::attack(std::map<GridPoint, std::shared_ptr<Character>, classcomp> &board,
-                        const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    GameStatus Sniper::attack(Board &board,
+                              const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
     {
-        attackInRange(src_coordinates, dst_coordinates);
+        GameStatus in_range = attackInRange(src_coordinates, dst_coordinates);
+        if (in_range != GameStatus::SUCCESS)
+        {
+            return in_range;
+        }
         if (ammo <= 0)
         {
-            throw OutOfAmmo();
+            return GameStatus::OUT_OF_AMMO;
         }
 
-        if (board.find(dst_coordinates) == board.end())
+        if (board.isEmpty(dst_coordinates))
         {
-            throw IllegalTarget();
+            return GameStatus::ILLEGAL_TARGET;
         }
         else
         {
-            std::shared_ptr<Character> target = board.at(dst_coordinates);
+            Character *target = board.characterAt(dst_coordinates);
             if (!target->isEnemy(team))
             {
-                throw IllegalTarget();
+                return GameStatus::ILLEGAL_TARGET;
             }
 
             else
@@ -63,6 +70,7 @@ namespace mtm
 
             ammo -= attack_cost;
         }
+        return GameStatus::SUCCESS;
     }
     CharacterType Sniper::getType()
     {
@@ -20,20 +20,20 @@ namespace mtm
         ~Sniper() = default;
 
         std::shared_ptr<Character> clone() const override;
-        void attackInRange(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
+        GameStatus attackInRange(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
         /**
          * @brief attack function of sniper: if the attacked character is inside the (range//2) range from the sniper
          * the attack is illegal, every third successful shot the sniper does twice the regular damage.
          * @param board refrence to the game board
          * @param src_coordinates attacking character`s coords
          * @param dst_coordinates attacked character`s coords
-         * @exception OutOfAmmo if the sniper dont have any ammo
-         * @exception IllegalTarget if the target is an empty cell or a friend.
-         * @exception outOfRange if the target is out of range (using attackInRange aux func)
+         * @return OUT_OF_AMMO if the sniper dont have any ammo
+         * @return ILLEGAL_TARGET if the target is an empty cell or a friend.
+         * @return OUT_OF_RANGE if the target is out of range (using attackInRange aux func)
          * or inside the (range//2) range.
          */
-        void attack(std::map<GridPoint, std::shared_ptr<Character>, classcomp> &board,
-                    const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
+        GameStatus attack(Board &board,
+                          const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
         CharacterType getType() override;
     };
 }
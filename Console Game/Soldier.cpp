@@ -4,7 +4,6 @@
 #include "Soldier.h"
 
 #include <memory>
-#include <map>
 #include <vector>
 #include <iterator>
 #include <cmath>
@@ -24,22 +23,25 @@ namespace mtm
         return ptr;
     }
 
-    void Soldier::attack(std::map<GridPoint, std::shared_ptr<Character>, classcomp> &board,
-                         const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    GameStatus Soldier::attack(Board &board,
+                               const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
     {
-        attackInRange(src_coordinates, dst_coordinates);
+        GameStatus in_range = attackInRange(src_coordinates, dst_coordinates);
+        if (in_range != GameStatus::SUCCESS)
+        {
+            return in_range;
+        }
         if (ammo <= 0)
         {
-            throw OutOfAmmo();
+            return GameStatus::OUT_OF_AMMO;
         }
         if (src_coordinates.row != dst_coordinates.row && src_coordinates.col != dst_coordinates.col)
         {
-            throw IllegalTarget();
+            return GameStatus::ILLEGAL_TARGET;
         }
-        std::shared_ptr<Character> target;
-        if (board.find(dst_coordinates) != board.end())
+        Character *target = board.characterAt(dst_coordinates);
+        if (target != nullptr)
         {
-            target = board.at(dst_coordinates);
             if (target->isEnemy(team))
             {
                 if (target->takeDamage(power))
@@ -48,20 +50,20 @@ namespace mtm
                 }
             }
         }
-        std::vector<GridPoint> kills;
-        int current_range;
-        for (std::map<GridPoint, std::shared_ptr<Character>, classcomp>::iterator itr = board.begin(); itr != board.end(); ++itr)
+        std::vector<GridPoint> in_splash, kills;
+        board.findInRange(dst_coordinates, (int)ceil((double)range / 3.0), in_splash);
+        for (const GridPoint &current : in_splash)
         {
-            current_range = GridPoint::distance(dst_coordinates, itr->first);
-            if (current_range != 0 && current_range <= (int)ceil((double)range / 3.0))
+            if (GridPoint::distance(dst_coordinates, current) == 0)
+            {
+                continue;
+            }
+            target = board.characterAt(current);
+            if (target->isEnemy(team))
             {
-                target = itr->second;
-                if (target->isEnemy(team))
+                if (target->takeDamage((int)ceil((double)power / 2.0)))
                 {
-                    if (target->takeDamage((int)ceil((double)power / 2.0)))
-                    {
-                        kills.push_back(itr->first);
-                    }
+                    kills.push_back(current);
                 }
             }
         }
@@ -70,6 +72,7 @@ namespace mtm
             board.erase(target);
         }
         ammo -= attack_cost;
+        return GameStatus::SUCCESS;
     }
 
     CharacterType Soldier::getType()
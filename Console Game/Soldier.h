@@ -5,7 +5,6 @@
 #include "Character.h"
 
 #include <memory>
-#include <map>
 
 namespace mtm
 {
@@ -25,12 +24,12 @@ namespace mtm
          * @param board refrence to the game board
          * @param src_coordinates attacking character`s coords
          * @param dst_coordinates attacked character`s coords
-         * @exception OutOfAmmo if the soldier dont have any ammo
-         * @exception IllegalTarget if the target is not alligned with the soldier.
-         * @exception outOfRange if the target is out of range (using attackInRange aux func)
+         * @return OUT_OF_AMMO if the soldier dont have any ammo
+         * @return ILLEGAL_TARGET if the target is not alligned with the soldier.
+         * @return OUT_OF_RANGE if the target is out of range (using attackInRange aux func)
          */
-        void attack(std::map<GridPoint, std::shared_ptr<Character>, classcomp> &board,
-                    const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
+        GameStatus attack(Board &board,
+                          const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
         CharacterType getType() override;
 
         // void legalAttack(std::vector<std::vector<std::shared_ptr<Character>>> &board,
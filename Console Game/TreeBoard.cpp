@@ -0,0 +1,69 @@
+#include "Auxiliaries.h"
+#include "Board.h"
+#include "TreeBoard.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <map>
+#include <vector>
+
+namespace mtm
+{
+    TreeBoard::TreeBoard(int height, int width, CharacterPool &characters) : Board(height, width, characters), cells() {}
+
+    BoardStorage TreeBoard::getStorage() const
+    {
+        return BoardStorage::TREE;
+    }
+
+    CharacterHandle TreeBoard::at(const GridPoint &coordinates) const
+    {
+        std::map<GridPoint, CharacterHandle, classcomp>::const_iterator itr = cells.find(coordinates);
+        return itr == cells.end() ? NO_CHARACTER : itr->second;
+    }
+
+    void TreeBoard::insertCell(const GridPoint &coordinates, CharacterHandle character)
+    {
+        cells.insert(std::make_pair(coordinates, character));
+    }
+
+    void TreeBoard::eraseCell(const GridPoint &coordinates)
+    {
+        cells.erase(coordinates);
+    }
+
+    void TreeBoard::move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates)
+    {
+        std::map<GridPoint, CharacterHandle, classcomp>::iterator itr = cells.find(src_coordinates);
+        CharacterHandle character = itr->second;
+        cells.erase(itr);
+        cells.insert(std::make_pair(dst_coordinates, character));
+    }
+
+    void TreeBoard::forEach(const Visitor &visitor) const
+    {
+        for (std::map<GridPoint, CharacterHandle, classcomp>::const_iterator itr = cells.begin();
+             itr != cells.end(); ++itr)
+        {
+            visitor(itr->first, itr->second);
+        }
+    }
+
+    void TreeBoard::findInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const
+    {
+        int first_row = std::max(0, center.row - radius);
+        int last_row = std::min(height - 1, center.row + radius);
+        for (int i = first_row; i <= last_row; ++i)
+        {
+            int reach = radius - std::abs(i - center.row);
+            int last_col = center.col + reach;
+            for (std::map<GridPoint, CharacterHandle, classcomp>::const_iterator itr =
+                     cells.lower_bound(GridPoint(i, center.col - reach));
+                 itr != cells.end() && itr->first.row == i && itr->first.col <= last_col; ++itr)
+            {
+                found.push_back(itr->first);
+            }
+        }
+    }
+}
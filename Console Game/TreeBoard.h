@@ -0,0 +1,56 @@
+#ifndef TREE_BOARD_H
+#define TREE_BOARD_H
+
+#include "Auxiliaries.h"
+#include "Board.h"
+
+#include <memory>
+#include <map>
+#include <vector>
+
+namespace mtm
+{
+    struct classcomp
+    {
+        /**
+         * @brief compare function between 2 gridpoints, used by the map
+         * actring as a < operator
+         * @return true if g1<g2 (comes before him on the board)
+         */
+        bool operator()(const GridPoint &g1, const GridPoint &g2) const
+        {
+            return (g1.row == g2.row) ? g1.col < g2.col : g1.row < g2.row;
+        }
+    };
+
+    class TreeBoard : public Board
+    {
+        std::map<GridPoint, CharacterHandle, classcomp> cells;
+
+    protected:
+        void insertCell(const GridPoint &coordinates, CharacterHandle character) override;
+        void eraseCell(const GridPoint &coordinates) override;
+
+    public:
+        /**
+         * @brief create empty board that keeps only the occupied cells, ordered by their position.
+         */
+        TreeBoard(int height, int width, CharacterPool &characters);
+        TreeBoard(const TreeBoard &) = default;
+        TreeBoard() = delete;
+        ~TreeBoard() = default;
+
+        BoardStorage getStorage() const override;
+        CharacterHandle at(const GridPoint &coordinates) const override;
+        void move(const GridPoint &src_coordinates, const GridPoint &dst_coordinates) override;
+        /**
+         * @brief visits the occupied cells in row-major order.
+         */
+        void forEach(const Visitor &visitor) const override;
+        /**
+         * @brief walks only the cells in the radius of each row, found by the map order.
+         */
+        void findInRange(const GridPoint &center, int radius, std::vector<GridPoint> &found) const override;
+    };
+}
+#endif
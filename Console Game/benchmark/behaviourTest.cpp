@@ -0,0 +1,619 @@
+/**
+ * Behaviour checks of mtm::Game against a model of the original game, on random games.
+ * the model keeps the characters in a std::map by cell, with the rules of the original Soldier, Medic and
+ * Sniper, and every action is played on the game (through the throwing API or the try* API) and the model,
+ * comparing the result of the action, the printed board and isOver after each one, for every board storage.
+ * every check prints one line, the exit code is the number of failed checks.
+ *
+ * build and run from the "Console Game" directory (with the course Auxiliaries.h/.cpp):
+ *   g++ -std=c++11 -O2 -I. benchmark/behaviourTest.cpp Auxiliaries.cpp Board.cpp Character.cpp \
+ *       CharacterPool.cpp ChunkedBoard.cpp DenseBoard.cpp Exceptions.cpp Game.cpp HashBoard.cpp Medic.cpp \
+ *       Sniper.cpp Soldier.cpp TreeBoard.cpp -o behaviourTest
+ *   ./behaviourTest [seed]
+ */
+#include "CharacterPool.h"
+#include "Game.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using mtm::CharacterType;
+using mtm::Game;
+using mtm::GameStatus;
+using mtm::GridPoint;
+using mtm::Team;
+
+static int failures = 0;
+
+/**
+ * @brief prints the result of a check and counts the failures
+ */
+static void check(const char *name, bool passed)
+{
+    std::cout << (passed ? "ok      " : "FAILED  ") << name << std::endl;
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+/**
+ * @brief runs a throwing action and gives the status of the exception it threw (SUCCESS if none)
+ */
+template <typename action>
+static GameStatus statusOf(action func)
+{
+    try
+    {
+        func();
+        return GameStatus::SUCCESS;
+    }
+    catch (const mtm::IllegalArgument &)
+    {
+        return GameStatus::ILLEGAL_ARGUMENT;
+    }
+    catch (const mtm::IllegalCell &)
+    {
+        return GameStatus::ILLEGAL_CELL;
+    }
+    catch (const mtm::CellEmpty &)
+    {
+        return GameStatus::CELL_EMPTY;
+    }
+    catch (const mtm::MoveTooFar &)
+    {
+        return GameStatus::MOVE_TOO_FAR;
+    }
+    catch (const mtm::CellOccupied &)
+    {
+        return GameStatus::CELL_OCCUPIED;
+    }
+    catch (const mtm::OutOfRange &)
+    {
+        return GameStatus::OUT_OF_RANGE;
+    }
+    catch (const mtm::OutOfAmmo &)
+    {
+        return GameStatus::OUT_OF_AMMO;
+    }
+    catch (const mtm::IllegalTarget &)
+    {
+        return GameStatus::ILLEGAL_TARGET;
+    }
+}
+
+/*=======================================================================*/
+/*=============================== the model =============================*/
+/*=======================================================================*/
+
+struct ModelCharacter
+{
+    CharacterType type;
+    Team team;
+    int health, ammo, range, power;
+    int shots_fired;
+
+    int movementRange() const
+    {
+        return type == CharacterType::SOLDIER ? 3 : type == CharacterType::MEDIC ? 5 : 4;
+    }
+    int reloadAmount() const
+    {
+        return type == CharacterType::SOLDIER ? 3 : type == CharacterType::MEDIC ? 5 : 2;
+    }
+};
+
+/**
+ * @brief the original game: the rules of the original Game, Soldier, Medic and Sniper, checked in the same order
+ */
+struct GameModel
+{
+    typedef std::pair<int, int> Cell;
+
+    int height, width;
+    std::map<Cell, ModelCharacter> board;
+
+    static int distance(const Cell &first, const Cell &second)
+    {
+        return std::abs(first.first - second.first) + std::abs(first.second - second.second);
+    }
+    bool inBoard(const Cell &cell) const
+    {
+        return cell.first >= 0 && cell.first < height && cell.second >= 0 && cell.second < width;
+    }
+    /**
+     * @brief hits the character in the cell if it is an enemy of the team, a killed character is removed
+     */
+    void hit(const Cell &cell, Team team, int damage)
+    {
+        std::map<Cell, ModelCharacter>::iterator target = board.find(cell);
+        if (target != board.end() && target->second.team != team)
+        {
+            target->second.health -= damage;
+            if (target->second.health <= 0)
+            {
+                board.erase(target);
+            }
+        }
+    }
+
+    GameStatus add(const Cell &cell, const ModelCharacter &character)
+    {
+        if (character.health <= 0 || character.ammo < 0 || character.range < 0 || character.power < 0)
+        {
+            return GameStatus::ILLEGAL_ARGUMENT;
+        }
+        if (!inBoard(cell))
+        {
+            return GameStatus::ILLEGAL_CELL;
+        }
+        if (board.count(cell))
+        {
+            return GameStatus::CELL_OCCUPIED;
+        }
+        board[cell] = character;
+        return GameStatus::SUCCESS;
+    }
+    GameStatus move(const Cell &src, const Cell &dst)
+    {
+        if (!inBoard(src) || !inBoard(dst))
+        {
+            return GameStatus::ILLEGAL_CELL;
+        }
+        if (!board.count(src))
+        {
+            return GameStatus::CELL_EMPTY;
+        }
+        if (distance(src, dst) > board[src].movementRange())
+        {
+            return GameStatus::MOVE_TOO_FAR;
+        }
+        if (board.count(dst))
+        {
+            return GameStatus::CELL_OCCUPIED;
+        }
+        board[dst] = board[src];
+        board.erase(src);
+        return GameStatus::SUCCESS;
+    }
+    GameStatus reload(const Cell &cell)
+    {
+        if (!inBoard(cell))
+        {
+            return GameStatus::ILLEGAL_CELL;
+        }
+        if (!board.count(cell))
+        {
+            return GameStatus::CELL_EMPTY;
+        }
+        board[cell].ammo += board[cell].reloadAmount();
+        return GameStatus::SUCCESS;
+    }
+    GameStatus attack(const Cell &src, const Cell &dst)
+    {
+        if (!inBoard(src) || !inBoard(dst))
+        {
+            return GameStatus::ILLEGAL_CELL;
+        }
+        if (!board.count(src))
+        {
+            return GameStatus::CELL_EMPTY;
+        }
+        ModelCharacter &attacker = board[src];
+        int length = distance(src, dst);
+        if (length > attacker.range || (attacker.type == CharacterType::SNIPER && length < (attacker.range + 1) / 2))
+        {
+            return GameStatus::OUT_OF_RANGE;
+        }
+        if (attacker.ammo <= 0)
+        {
+            return GameStatus::OUT_OF_AMMO;
+        }
+        switch (attacker.type)
+        {
+        case CharacterType::SOLDIER:
+        {
+            if (src.first != dst.first && src.second != dst.second)
+            {
+                return GameStatus::ILLEGAL_TARGET;
+            }
+            attacker.ammo--;
+            ModelCharacter soldier = attacker;
+            hit(dst, soldier.team, soldier.power);
+            std::vector<Cell> splashed;
+            for (const std::pair<const Cell, ModelCharacter> &cell : board)
+            {
+                int splash = distance(dst, cell.first);
+                if (splash != 0 && splash <= (soldier.range + 2) / 3)
+                {
+                    splashed.push_back(cell.first);
+                }
+            }
+            for (const Cell &cell : splashed)
+            {
+                hit(cell, soldier.team, (soldier.power + 1) / 2);
+            }
+            return GameStatus::SUCCESS;
+        }
+        case CharacterType::MEDIC:
+            if (length == 0 || !board.count(dst))
+            {
+                return GameStatus::ILLEGAL_TARGET;
+            }
+            if (board[dst].team == attacker.team)
+            {
+                board[dst].health += attacker.power;
+                return GameStatus::SUCCESS;
+            }
+            attacker.ammo--;
+            hit(dst, attacker.team, attacker.power);
+            return GameStatus::SUCCESS;
+        default:
+            if (!board.count(dst) || board[dst].team == attacker.team)
+            {
+                return GameStatus::ILLEGAL_TARGET;
+            }
+            attacker.ammo--;
+            attacker.shots_fired++;
+            hit(dst, attacker.team, attacker.shots_fired % 3 ? attacker.power : 2 * attacker.power);
+            return GameStatus::SUCCESS;
+        }
+    }
+    bool isOver(Team *winning_team) const
+    {
+        if (board.empty())
+        {
+            return false;
+        }
+        Team team = board.begin()->second.team;
+        for (const std::pair<const Cell, ModelCharacter> &cell : board)
+        {
+            if (cell.second.team != team)
+            {
+                return false;
+            }
+        }
+        *winning_team = team;
+        return true;
+    }
+    std::string print() const
+    {
+        std::string cells(height * width, ' ');
+        for (const std::pair<const Cell, ModelCharacter> &cell : board)
+        {
+            char letter = cell.second.type == CharacterType::SOLDIER ? 's' : cell.second.type == CharacterType::MEDIC ? 'm' : 'n';
+            cells[cell.first.first * width + cell.first.second] =
+                cell.second.team == Team::POWERLIFTERS ? (char)(letter - 'a' + 'A') : letter;
+        }
+        std::ostringstream out;
+        mtm::printGameBoard(out, &*cells.begin(), &*cells.end(), width);
+        return out.str();
+    }
+};
+
+static std::string printed(const Game &game)
+{
+    std::ostringstream out;
+    out << game;
+    return out.str();
+}
+
+/**
+ * @brief the game and the model print the same board and agree on isOver and the winner
+ */
+static bool sameGames(const Game &game, const GameModel &model)
+{
+    Team winner = Team::POWERLIFTERS, model_winner = Team::POWERLIFTERS;
+    bool over = game.isOver(&winner);
+    bool model_over = model.isOver(&model_winner);
+    return printed(game) == model.print() && over == model_over && (!over || winner == model_winner);
+}
+
+/*=======================================================================*/
+/*================================ random ===============================*/
+/*=======================================================================*/
+
+/**
+ * @brief a cell of the board, or (rarely) one just outside it
+ */
+static GameModel::Cell randomCell(std::mt19937 &random, const GameModel &model)
+{
+    if (random() % 20 == 0)
+    {
+        return GameModel::Cell((int)(random() % (model.height + 2)) - 1, random() % 2 ? -1 : model.width);
+    }
+    return GameModel::Cell((int)(random() % model.height), (int)(random() % model.width));
+}
+
+/**
+ * @brief a cell a few steps away, so most moves and attacks are in range
+ */
+static GameModel::Cell nearCell(std::mt19937 &random, const GameModel &model, const GameModel::Cell &cell)
+{
+    if (random() % 4 == 0)
+    {
+        return randomCell(random, model);
+    }
+    return GameModel::Cell(cell.first + (int)(random() % 9) - 4, cell.second + (int)(random() % 9) - 4);
+}
+
+/**
+ * @brief a cell with a character when there is one, so the actions are not mostly CellEmpty
+ */
+static GameModel::Cell someCharacter(std::mt19937 &random, const GameModel &model)
+{
+    if (model.board.empty() || random() % 10 == 0)
+    {
+        return randomCell(random, model);
+    }
+    std::map<GameModel::Cell, ModelCharacter>::const_iterator it = model.board.begin();
+    std::advance(it, random() % model.board.size());
+    return it->first;
+}
+
+static ModelCharacter randomCharacter(std::mt19937 &random)
+{
+    ModelCharacter character;
+    character.type = (CharacterType)(random() % 3);
+    character.team = random() % 2 ? Team::CROSSFITTERS : Team::POWERLIFTERS;
+    character.health = (int)(random() % 12) - (random() % 10 == 0 ? 11 : 0);
+    character.ammo = (int)(random() % 4) - (random() % 20 == 0 ? 1 : 0);
+    character.range = (int)(random() % 8) - (random() % 20 == 0 ? 8 : 0);
+    character.power = (int)(random() % 6) - (random() % 20 == 0 ? 6 : 0);
+    character.shots_fired = 0;
+    return character;
+}
+
+/**
+ * @brief plays one random action on the game and the model
+ * @return true if the game gave the same result as the model
+ */
+static bool playRandomAction(std::mt19937 &random, Game &game, GameModel &model)
+{
+    bool throwing = random() % 2 == 0;
+    GameModel::Cell src = someCharacter(random, model);
+    GridPoint src_point(src.first, src.second);
+    GameStatus status, expected;
+    switch (random() % 6)
+    {
+    case 0:
+    {
+        ModelCharacter character = randomCharacter(random);
+        GameModel::Cell cell = randomCell(random, model);
+        GridPoint point(cell.first, cell.second);
+        expected = model.add(cell, character);
+        status = statusOf([&]()
+                          {
+                              std::shared_ptr<mtm::Character> made = Game::makeCharacter(
+                                  character.type, character.team, character.health, character.ammo, character.range,
+                                  character.power);
+                              if (throwing)
+                              {
+                                  game.addCharacter(point, made);
+                              }
+                              else
+                              {
+                                  mtm::throwIfFailed(game.tryAddCharacter(point, made));
+                              }
+                          });
+        break;
+    }
+    case 1:
+    {
+        GameModel::Cell dst = nearCell(random, model, src);
+        GridPoint dst_point(dst.first, dst.second);
+        expected = model.move(src, dst);
+        status = throwing ? statusOf([&]()
+                                     { game.move(src_point, dst_point); })
+                          : game.tryMove(src_point, dst_point);
+        break;
+    }
+    case 2:
+        expected = model.reload(src);
+        status = throwing ? statusOf([&]()
+                                     { game.reload(src_point); })
+                          : game.tryReload(src_point);
+        break;
+    default:
+    {
+        GameModel::Cell dst = random() % 3 ? someCharacter(random, model) : nearCell(random, model, src);
+        GridPoint dst_point(dst.first, dst.second);
+        expected = model.attack(src, dst);
+        status = throwing ? statusOf([&]()
+                                     { game.attack(src_point, dst_point); })
+                          : game.tryAttack(src_point, dst_point);
+        break;
+    }
+    }
+    return status == expected && sameGames(game, model);
+}
+
+/*=======================================================================*/
+/*=============================== checks ================================*/
+/*=======================================================================*/
+
+/**
+ * @brief user-025: with the characters in the pool, every storage plays random games exactly like the
+ * original game, and changing a copy of a game doesnt change the game it was copied from
+ */
+static void checkGames(std::mt19937 &random)
+{
+    const char *const names[] = {"auto", "tree", "hash", "dense", "chunked"};
+    const int sizes[][2] = {{1, 1}, {3, 4}, {8, 8}, {12, 30}, {40, 40}};
+    for (int storage = 0; storage < 5; ++storage)
+    {
+        bool same = true, independent = true;
+        for (const int *size : sizes)
+        {
+            GameModel model = {size[0], size[1], std::map<GameModel::Cell, ModelCharacter>()};
+            Game game(size[0], size[1], (mtm::BoardStorage)storage);
+            int actions = 2000;
+            for (int i = 0; i < actions && same; ++i)
+            {
+                same &= playRandomAction(random, game, model);
+            }
+            Game copy(game);
+            GameModel copy_model = model;
+            Game assigned(1, 1);
+            assigned = game;
+            for (int i = 0; i < 200 && same; ++i)
+            {
+                same &= playRandomAction(random, copy, copy_model);
+            }
+            independent &= sameGames(game, model) && sameGames(assigned, model);
+        }
+        std::string same_name = std::string("user-025 ") + names[storage] + " storage plays like the original game";
+        std::string copy_name = std::string("user-025 ") + names[storage] + " storage copies are independent";
+        check(same_name.c_str(), same);
+        check(copy_name.c_str(), independent);
+    }
+    Game large(300, 300, mtm::BoardStorage::DENSE);
+    GameModel large_model = {300, 300, std::map<GameModel::Cell, ModelCharacter>()};
+    bool same_large = true;
+    for (int i = 0; i < 500 && same_large; ++i)
+    {
+        same_large &= playRandomAction(random, large, large_model);
+    }
+    check("user-001 a large board can be DENSE and plays like the original game",
+          same_large && statusOf([]()
+                                 { Game game(0, 5, mtm::BoardStorage::DENSE); }) == GameStatus::ILLEGAL_ARGUMENT);
+}
+
+/**
+ * @brief true if the health of the character is exactly health (found on a clone, the character is not changed)
+ */
+static bool hasHealth(const mtm::Character &character, int health)
+{
+    std::shared_ptr<mtm::Character> probe = character.clone();
+    return !probe->takeDamage(health - 1) && probe->takeDamage(1);
+}
+
+/**
+ * @brief user-025: released slots are reused by the next characters of the same type, and the characters
+ * that were not released keep their handles, addresses and values
+ */
+static void checkCharacterPool(std::mt19937 &random)
+{
+    mtm::CharacterPool pool;
+    std::vector<mtm::CharacterHandle> handles;
+    std::vector<int> healths;
+    std::vector<mtm::Character *> addresses;
+    for (int i = 0; i < 300; ++i)
+    {
+        int health = 1 + (int)(random() % 1000);
+        std::shared_ptr<mtm::Character> character = Game::makeCharacter(
+            (CharacterType)(random() % 3), random() % 2 ? Team::CROSSFITTERS : Team::POWERLIFTERS, health, 1, 1, 1);
+        handles.push_back(pool.add(*character));
+        healths.push_back(health);
+        addresses.push_back(&pool.get(handles.back()));
+    }
+    bool reused = true;
+    for (int round = 0; round < 200; ++round)
+    {
+        int index = (int)(random() % handles.size());
+        mtm::CharacterHandle released = handles[index];
+        CharacterType type = mtm::CharacterPool::typeOf(released);
+        Team team = mtm::CharacterPool::teamOf(released);
+        pool.release(released);
+        int health = 1 + (int)(random() % 1000);
+        std::shared_ptr<mtm::Character> character = Game::makeCharacter(type, team, health, 1, 1, 1);
+        handles[index] = pool.add(*character);
+        healths[index] = health;
+        reused &= handles[index] == released && &pool.get(handles[index]) == addresses[index];
+    }
+    bool kept = true;
+    for (std::size_t i = 0; i < handles.size(); ++i)
+    {
+        kept &= &pool.get(handles[i]) == addresses[i] && hasHealth(pool.get(handles[i]), healths[i]) &&
+                pool.get(handles[i]).getType() == mtm::CharacterPool::typeOf(handles[i]) &&
+                !pool.get(handles[i]).isEnemy(mtm::CharacterPool::teamOf(handles[i]));
+    }
+    mtm::CharacterPool copy(pool);
+    bool same_copy = true;
+    for (std::size_t i = 0; i < handles.size(); ++i)
+    {
+        copy.get(handles[i]).takeDamage(-1);
+        same_copy &= hasHealth(copy.get(handles[i]), healths[i] + 1) && hasHealth(pool.get(handles[i]), healths[i]);
+    }
+    check("user-025 a released slot is reused by the next character of its type and team", reused);
+    check("user-025 the other characters keep their handles, addresses and values", kept);
+    check("user-025 a copy of the pool has the same handles and its own characters", same_copy);
+}
+
+/**
+ * @brief counts the live objects, the copy throws once copies_left copies were made
+ */
+struct Counted
+{
+    static int live;
+    static int copies_left;
+
+    Counted() { live++; }
+    Counted(const Counted &)
+    {
+        if (copies_left-- == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        live++;
+    }
+    ~Counted() { live--; }
+};
+
+int Counted::live = 0;
+int Counted::copies_left = 0;
+
+/**
+ * @brief user-025: a pool copy that fails part way destroys the characters it already copied
+ */
+static void checkFailedPoolCopy(std::mt19937 &random)
+{
+    bool cleaned = true;
+    {
+        mtm::TypedPool<Counted> pool;
+        std::vector<std::uint32_t> slots;
+        Counted::copies_left = -1;
+        for (int i = 0; i < 150; ++i)
+        {
+            slots.push_back(pool.add(Counted()));
+        }
+        for (int i = 0; i < 20; ++i)
+        {
+            pool.release(slots[random() % 3 == 0 ? i * 7 : i * 7 + 1]);
+        }
+        int live = Counted::live;
+        for (int attempt = 0; attempt < 10; ++attempt)
+        {
+            Counted::copies_left = (int)(random() % live);
+            try
+            {
+                mtm::TypedPool<Counted> copy(pool);
+                cleaned = false;
+            }
+            catch (const std::runtime_error &)
+            {
+            }
+            cleaned &= Counted::live == live;
+        }
+        Counted::copies_left = -1;
+    }
+    check("user-025 a pool copy that throws destroys the characters it copied", cleaned && Counted::live == 0);
+}
+
+int main(int argc, char **argv)
+{
+    std::mt19937 random(argc > 1 ? (unsigned int)std::strtoul(argv[1], nullptr, 10) : 2021);
+    checkGames(random);
+    checkCharacterPool(random);
+    checkFailedPoolCopy(random);
+    return failures;
+}
@@ -0,0 +1,110 @@
+/**
+ * Throw/catch cost of the game exceptions: the current mtm::Exception (static message)
+ * against the previous implementation (message built in a std::string and copied to new char[]).
+ * the static message saves the 2 allocations of every throw, the time per throw is mostly the unwinding
+ * and changes more between runs than between the two implementations, so dont read a speedup from it.
+ *
+ * build and run from the "Console Game" directory:
+ *   g++ -std=c++11 -O2 -I. benchmark/exceptionsBenchmark.cpp Exceptions.cpp -o exceptionsBenchmark
+ *   ./exceptionsBenchmark [iterations]
+ */
+#include "Exceptions.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <new>
+#include <string>
+
+static unsigned long allocations = 0;
+
+void *operator new(std::size_t size)
+{
+    allocations++;
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+namespace legacy
+{
+    /**
+     * @brief the previous mtm::Exception, kept here as the baseline of the benchmark.
+     */
+    class Exception : public std::exception
+    {
+    public:
+        Exception(std::string name)
+        {
+            std::string msg_s = "A game related error has occurred: " + name;
+            msg = new char[msg_s.length() + 1];
+            strcpy(msg, msg_s.c_str());
+        }
+        Exception(Exception &&other) noexcept : msg(other.msg)
+        {
+            other.msg = nullptr;
+        }
+        ~Exception() noexcept
+        {
+            if (msg != nullptr)
+            {
+                delete[] msg;
+            }
+        }
+        virtual const char *what() const noexcept
+        {
+            return msg;
+        }
+        char *msg;
+    };
+
+    class CellOccupied : public Exception
+    {
+    public:
+        explicit CellOccupied() : Exception("CellOccupied") {}
+    };
+}
+
+template <typename thrower>
+static void run(const char *name, long iterations, thrower throwException)
+{
+    unsigned long allocations_before = allocations;
+    std::size_t checksum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i)
+    {
+        try
+        {
+            throwException();
+        }
+        catch (const std::exception &e)
+        {
+            checksum += e.what()[0];
+        }
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << name << ": " << ns / iterations << " ns/throw, "
+              << (double)(allocations - allocations_before) / iterations << " allocations/throw"
+              << " (checksum " << checksum << ")" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    long iterations = argc > 1 ? std::atol(argv[1]) : 1000000;
+    run("legacy::CellOccupied", iterations, []()
+        { throw legacy::CellOccupied(); });
+    run("mtm::CellOccupied", iterations, []()
+        { throw mtm::CellOccupied(); });
+    return 0;
+}
@@ -0,0 +1,520 @@
+/**
+ * Headless simulation of mtm::Game: fills a board with characters through Game::makeCharacter and
+ * Game::addCharacter, then plays random move/attack/reload actions (or a script) through the
+ * non-throwing try* API and reports, for every character type and action, the actions per second,
+ * the latency percentiles and the allocations per action, one JSON line each.
+ * the random actions depend only on the seed, so two builds run with the same seed play the same game.
+ *
+ * build and run from the "Console Game" directory (with the course Auxiliaries.h/.cpp):
+ *   g++ -std=c++11 -O2 -I. benchmark/gameSimulation.cpp Auxiliaries.cpp Board.cpp Character.cpp \
+ *       CharacterPool.cpp ChunkedBoard.cpp DenseBoard.cpp Exceptions.cpp Game.cpp HashBoard.cpp Medic.cpp \
+ *       Sniper.cpp Soldier.cpp TreeBoard.cpp -o gameSimulation
+ *   ./gameSimulation [--height N] [--width N] [--density D] [--actions N] [--seed N]
+ *                    [--storage auto|tree|hash|dense|chunked] [--script FILE]
+ *
+ * a script has one action per line (rows and columns from 0, lines starting with # are ignored):
+ *   add soldier|medic|sniper powerlifters|crossfitters row col health ammo range power
+ *   move row col row col
+ *   attack row col row col
+ *   reload row col
+ */
+#include "Game.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace mtm;
+
+static unsigned long allocations = 0;
+
+void *operator new(std::size_t size)
+{
+    allocations++;
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+enum Action
+{
+    ADD,
+    MOVE,
+    ATTACK,
+    RELOAD,
+    ACTIONS
+};
+
+static const char *const ACTION_NAMES[] = {"add", "move", "attack", "reload"};
+static const char *const TYPE_NAMES[] = {"soldier", "medic", "sniper"};
+static const int TYPES = 3;
+static const int STATUSES = (int)GameStatus::ILLEGAL_TARGET + 1;
+
+/**
+ * @brief the measurements of one action of one character type
+ */
+struct Stats
+{
+    std::vector<double> latencies;
+    unsigned long allocations = 0;
+    long successes = 0;
+    long statuses[STATUSES] = {};
+};
+
+/**
+ * @brief a character the simulation added, its position is kept up to date by the moves
+ */
+struct Unit
+{
+    GridPoint position;
+    CharacterType type;
+    units_t range;
+    int slot;
+};
+
+/*=======================================================================*/
+/*========================== class Simulation ===========================*/
+/*=======================================================================*/
+
+/**
+ * @brief plays actions on a game and measures them.
+ * the game tells nothing about its characters, so the simulation tracks where every character it added
+ * is (owners). a character that died is found when an action on its cell returns CELL_EMPTY, that action
+ * is not measured and the character is dropped, and a character moving into a cell replaces whoever
+ * the simulation still had there (the move succeeded, so it was dead).
+ */
+class Simulation
+{
+    int height, width;
+    Game game;
+    std::mt19937 random;
+    std::vector<Unit> units;
+    std::vector<int> live;
+    std::unordered_map<long long, int> owners;
+    Stats stats[TYPES][ACTIONS];
+    long measured = 0;
+
+    long long key(const GridPoint &point) const
+    {
+        return (long long)point.row * width + point.col;
+    }
+
+    int below(int bound)
+    {
+        return (int)(random() % (unsigned int)bound);
+    }
+
+    /**
+     * @brief a random cell at distance of at most distance from the point, kept inside the board
+     */
+    GridPoint near(const GridPoint &point, int distance)
+    {
+        int row_offset = below(2 * distance + 1) - distance;
+        int left = distance - std::abs(row_offset);
+        int col_offset = below(2 * left + 1) - left;
+        return GridPoint(std::min(std::max(point.row + row_offset, 0), height - 1),
+                         std::min(std::max(point.col + col_offset, 0), width - 1));
+    }
+
+    /**
+     * @brief drops the character the simulation has in the cell, if any
+     */
+    void forget(const GridPoint &cell)
+    {
+        std::unordered_map<long long, int>::iterator owner = owners.find(key(cell));
+        if (owner == owners.end())
+        {
+            return;
+        }
+        Unit &unit = units[owner->second];
+        if (unit.slot >= 0)
+        {
+            units[live.back()].slot = unit.slot;
+            live[unit.slot] = live.back();
+            live.pop_back();
+            unit.slot = -1;
+        }
+        owners.erase(owner);
+    }
+
+    /**
+     * @brief runs the action and measures it under the type and action, unless it hit an empty
+     * source cell, then the character the simulation had there is dropped.
+     */
+    template <typename runner>
+    GameStatus measure(CharacterType type, Action action, const GridPoint &source, runner run)
+    {
+        unsigned long allocations_before = allocations;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        GameStatus status = run();
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        unsigned long action_allocations = allocations - allocations_before;
+        if (status == GameStatus::CELL_EMPTY && action != ADD)
+        {
+            forget(source);
+            return status;
+        }
+        Stats &stat = stats[type][action];
+        stat.latencies.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+        stat.allocations += action_allocations;
+        stat.statuses[(int)status]++;
+        stat.successes += status == GameStatus::SUCCESS ? 1 : 0;
+        measured++;
+        return status;
+    }
+
+    /**
+     * @brief the type the simulation has in the cell, or -1
+     */
+    int typeAt(const GridPoint &cell) const
+    {
+        std::unordered_map<long long, int>::const_iterator owner = owners.find(key(cell));
+        return owner == owners.end() ? -1 : (int)units[owner->second].type;
+    }
+
+public:
+    Simulation(int height, int width, BoardStorage storage, unsigned int seed)
+        : height(height), width(width), game(height, width, storage), random(seed)
+    {
+        for (int type = 0; type < TYPES; ++type)
+        {
+            for (int action = 0; action < ACTIONS; ++action)
+            {
+                stats[type][action].latencies.reserve(1 << 16);
+            }
+        }
+    }
+
+    long actions() const
+    {
+        return measured;
+    }
+
+    int liveCharacters() const
+    {
+        return (int)live.size();
+    }
+
+    /**
+     * @brief makes a character and adds it to the cell
+     * @return SUCCESS, or the reason it was not added
+     */
+    GameStatus add(CharacterType type, Team team, const GridPoint &cell,
+                   units_t health, units_t ammo, units_t range, units_t power)
+    {
+        GameStatus status = measure(type, ADD, cell, [&]()
+                                    { return game.tryAddCharacter(cell, Game::makeCharacter(type, team, health,
+                                                                                             ammo, range, power)); });
+        if (status == GameStatus::SUCCESS)
+        {
+            forget(cell);
+            Unit unit = {cell, type, range, (int)live.size()};
+            owners[key(cell)] = (int)units.size();
+            live.push_back((int)units.size());
+            units.push_back(unit);
+        }
+        return status;
+    }
+
+    /**
+     * @brief adds characters of random types, teams and stats to random free cells
+     * until density of the cells are taken
+     */
+    void populate(double density)
+    {
+        long long cells = (long long)height * width;
+        long long target = (long long)(density * cells);
+        while ((long long)live.size() < target)
+        {
+            GridPoint cell(below(height), below(width));
+            if (owners.count(key(cell)) > 0)
+            {
+                continue;
+            }
+            add((CharacterType)below(TYPES), below(2) == 0 ? POWERLIFTERS : CROSSFITTERS, cell,
+                10 + below(21), below(6), 1 + below(6), 1 + below(8));
+        }
+    }
+
+    GameStatus move(const GridPoint &source, const GridPoint &destination)
+    {
+        int type = typeAt(source);
+        if (type < 0)
+        {
+            return game.tryMove(source, destination);
+        }
+        GameStatus status = measure((CharacterType)type, MOVE, source, [&]()
+                                    { return game.tryMove(source, destination); });
+        if (status == GameStatus::SUCCESS && !(source == destination))
+        {
+            int index = owners[key(source)];
+            owners.erase(key(source));
+            forget(destination);
+            owners[key(destination)] = index;
+            units[index].position = destination;
+        }
+        return status;
+    }
+
+    GameStatus attack(const GridPoint &source, const GridPoint &destination)
+    {
+        int type = typeAt(source);
+        if (type < 0)
+        {
+            return game.tryAttack(source, destination);
+        }
+        return measure((CharacterType)type, ATTACK, source, [&]()
+                       { return game.tryAttack(source, destination); });
+    }
+
+    GameStatus reload(const GridPoint &cell)
+    {
+        int type = typeAt(cell);
+        if (type < 0)
+        {
+            return game.tryReload(cell);
+        }
+        return measure((CharacterType)type, RELOAD, cell, [&]()
+                       { return game.tryReload(cell); });
+    }
+
+    /**
+     * @brief plays count random actions (40% moves, 40% attacks, 20% reloads) of random characters,
+     * or less if the game is over first.
+     */
+    void play(long count)
+    {
+        long target = measured + count;
+        for (long played = 0; measured < target && live.size() > 1; ++played)
+        {
+            if ((played & 1023) == 0 && game.isOver())
+            {
+                return;
+            }
+            const Unit &unit = units[live[below((int)live.size())]];
+            GridPoint source = unit.position;
+            int action = below(10);
+            if (action < 4)
+            {
+                move(source, near(source, 5));
+            }
+            else if (action < 8)
+            {
+                attack(source, near(source, unit.range));
+            }
+            else
+            {
+                reload(source);
+            }
+        }
+    }
+
+    /**
+     * @brief plays the script
+     * @exception IllegalArgument if a line is not a valid action
+     */
+    void play(std::istream &script)
+    {
+        std::string line;
+        while (std::getline(script, line))
+        {
+            std::istringstream words(line);
+            std::string action;
+            if (!(words >> action) || action[0] == '#')
+            {
+                continue;
+            }
+            int row = 0, col = 0, dst_row = 0, dst_col = 0;
+            if (action == "add")
+            {
+                std::string type, team;
+                units_t health = 0, ammo = 0, range = 0, power = 0;
+                if (!(words >> type >> team >> row >> col >> health >> ammo >> range >> power))
+                {
+                    throw IllegalArgument();
+                }
+                const char *const *type_name = std::find(TYPE_NAMES, TYPE_NAMES + TYPES, type);
+                if (type_name == TYPE_NAMES + TYPES || (team != "powerlifters" && team != "crossfitters"))
+                {
+                    throw IllegalArgument();
+                }
+                add((CharacterType)(type_name - TYPE_NAMES), team == "powerlifters" ? POWERLIFTERS : CROSSFITTERS,
+                    GridPoint(row, col), health, ammo, range, power);
+            }
+            else if (action == "move" && words >> row >> col >> dst_row >> dst_col)
+            {
+                move(GridPoint(row, col), GridPoint(dst_row, dst_col));
+            }
+            else if (action == "attack" && words >> row >> col >> dst_row >> dst_col)
+            {
+                attack(GridPoint(row, col), GridPoint(dst_row, dst_col));
+            }
+            else if (action == "reload" && words >> row >> col)
+            {
+                reload(GridPoint(row, col));
+            }
+            else
+            {
+                throw IllegalArgument();
+            }
+        }
+    }
+
+    /**
+     * @brief prints one JSON line for every type and action that was measured
+     */
+    void report(std::ostream &os)
+    {
+        for (int type = 0; type < TYPES; ++type)
+        {
+            for (int action = 0; action < ACTIONS; ++action)
+            {
+                Stats &stat = stats[type][action];
+                std::vector<double> &latencies = stat.latencies;
+                if (latencies.empty())
+                {
+                    continue;
+                }
+                double total = 0;
+                for (double latency : latencies)
+                {
+                    total += latency;
+                }
+                std::sort(latencies.begin(), latencies.end());
+                std::size_t count = latencies.size();
+                os << "{\"type\":\"" << TYPE_NAMES[type] << "\",\"action\":\"" << ACTION_NAMES[action]
+                   << "\",\"count\":" << count << ",\"successes\":" << stat.successes
+                   << ",\"actions_per_s\":" << count / total * 1e9
+                   << ",\"p50_ns\":" << latencies[count / 2]
+                   << ",\"p90_ns\":" << latencies[count * 9 / 10]
+                   << ",\"p99_ns\":" << latencies[count * 99 / 100]
+                   << ",\"allocs_per_action\":" << (double)stat.allocations / count << ",\"statuses\":[";
+                for (int status = 0; status < STATUSES; ++status)
+                {
+                    os << (status == 0 ? "" : ",") << stat.statuses[status];
+                }
+                os << "]}" << std::endl;
+            }
+        }
+    }
+};
+
+static bool parseStorage(const char *name, BoardStorage *storage)
+{
+    static const char *const NAMES[] = {"auto", "tree", "hash", "dense", "chunked"};
+    static const BoardStorage STORAGES[] = {BoardStorage::AUTO, BoardStorage::TREE, BoardStorage::HASH,
+                                            BoardStorage::DENSE, BoardStorage::CHUNKED};
+    for (int i = 0; i < 5; ++i)
+    {
+        if (std::strcmp(name, NAMES[i]) == 0)
+        {
+            *storage = STORAGES[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    int height = 100, width = 100;
+    double density = 0.1;
+    long actions = 1000000;
+    unsigned int seed = 2021;
+    BoardStorage storage = BoardStorage::AUTO;
+    const char *storage_name = "auto";
+    const char *script = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        bool has_value = i + 1 < argc;
+        if (has_value && std::strcmp(argv[i], "--height") == 0)
+        {
+            height = std::atoi(argv[++i]);
+        }
+        else if (has_value && std::strcmp(argv[i], "--width") == 0)
+        {
+            width = std::atoi(argv[++i]);
+        }
+        else if (has_value && std::strcmp(argv[i], "--density") == 0)
+        {
+            density = std::atof(argv[++i]);
+        }
+        else if (has_value && std::strcmp(argv[i], "--actions") == 0)
+        {
+            actions = std::atol(argv[++i]);
+        }
+        else if (has_value && std::strcmp(argv[i], "--seed") == 0)
+        {
+            seed = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (has_value && std::strcmp(argv[i], "--script") == 0)
+        {
+            script = argv[++i];
+        }
+        else if (!(has_value && std::strcmp(argv[i], "--storage") == 0 && parseStorage(argv[i + 1], &storage)))
+        {
+            std::cerr << "usage: " << argv[0] << " [--height N] [--width N] [--density D] [--actions N] [--seed N]"
+                      << " [--storage auto|tree|hash|dense|chunked] [--script FILE]" << std::endl;
+            return 1;
+        }
+        else
+        {
+            storage_name = argv[++i];
+        }
+    }
+    if (height <= 0 || width <= 0 || density < 0 || density > 0.95)
+    {
+        std::cerr << "the board must be positive and the density between 0 and 0.95" << std::endl;
+        return 1;
+    }
+
+    Simulation simulation(height, width, storage, seed);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (script != nullptr)
+    {
+        std::ifstream file(script);
+        if (!file)
+        {
+            std::cerr << "cannot open " << script << std::endl;
+            return 1;
+        }
+        try
+        {
+            simulation.play(file);
+        }
+        catch (const mtm::Exception &e)
+        {
+            std::cerr << script << ": " << e.what() << std::endl;
+            return 1;
+        }
+    }
+    else
+    {
+        simulation.populate(density);
+        simulation.play(actions);
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    simulation.report(std::cout);
+    std::cout << "{\"summary\":{\"height\":" << height << ",\"width\":" << width << ",\"storage\":\"" << storage_name
+              << "\",\"seed\":" << seed << ",\"actions\":" << simulation.actions()
+              << ",\"live_characters\":" << simulation.liveCharacters()
+              << ",\"wall_ms\":" << std::chrono::duration<double, std::milli>(end - start).count() << "}}" << std::endl;
+    return 0;
+}
@@ -0,0 +1,1195 @@
+/**
+ * Behaviour checks of the SortedList family against a model of the original SortedList, on random input.
+ * the model is a std::vector kept sorted with std::upper_bound, so equal elements stay in insertion order,
+ * and every list is compared with it element by element (equal elements are told apart by an id).
+ * ExamDetails is compared with a model of the original class, that kept the fields as they were given.
+ * every check prints one line, the exit code is the number of failed checks.
+ *
+ * build and run from the "Generic Sorted List" directory:
+ *   g++ -std=c++11 -O2 -pthread -I. benchmark/behaviourTest.cpp examBatch.cpp examCalendar.cpp examDetails.cpp \
+ *       stringPool.cpp -o behaviourTest
+ *   ./behaviourTest [seed]
+ */
+#include "concurrentSortedList.h"
+#include "examBatch.h"
+#include "examCalendar.h"
+#include "examDetails.h"
+#include "examSerialization.h"
+#include "nodePool.h"
+#include "persistentSortedList.h"
+#include "sortedList.h"
+#include "sortedListView.h"
+#include "sortedSkipList.h"
+#include "stringPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using mtm::ExamDetails;
+using mtm::NodePool;
+using mtm::SortedList;
+
+static int failures = 0;
+
+/**
+ * @brief prints the result of one check
+ */
+static void check(const char *name, bool passed)
+{
+    if (!passed)
+    {
+        failures++;
+    }
+    std::cout << (passed ? "ok      " : "FAILED  ") << name << std::endl;
+}
+
+/*=======================================================================*/
+/*============================== the model ==============================*/
+/*=======================================================================*/
+
+/**
+ * @brief element ordered by its key only, the id tells equal elements apart. the comparisons are counted.
+ */
+struct Item
+{
+    int key;
+    int id;
+    static unsigned long comparisons;
+
+    bool operator<(const Item &other) const
+    {
+        comparisons++;
+        return key < other.key;
+    }
+};
+
+unsigned long Item::comparisons = 0;
+
+typedef std::vector<std::pair<int, int>> Trace;
+
+/**
+ * @brief the keys and ids of the elements, in iteration order
+ */
+template <class List>
+static Trace trace(const List &list)
+{
+    Trace result;
+    for (const Item &item : list)
+    {
+        result.push_back(std::make_pair(item.key, item.id));
+    }
+    return result;
+}
+
+/**
+ * @brief count items with keys in [0, keys), every item gets a new id
+ */
+static std::vector<Item> randomItems(std::mt19937 &random, int count, int keys)
+{
+    static int next_id = 0;
+    std::vector<Item> items;
+    for (int i = 0; i < count; ++i)
+    {
+        items.push_back(Item{(int)(random() % keys), next_id++});
+    }
+    return items;
+}
+
+/**
+ * @brief the original SortedList: a new element goes after the elements equal to it,
+ * filter keeps the order and apply inserts the results one by one.
+ */
+struct Model
+{
+    std::vector<Item> items;
+
+    void insert(const Item &item)
+    {
+        items.insert(std::upper_bound(items.begin(), items.end(), item), item);
+    }
+    template <typename predict>
+    Model filter(predict func) const
+    {
+        Model result;
+        for (const Item &item : items)
+        {
+            if (func(item))
+            {
+                result.items.push_back(item);
+            }
+        }
+        return result;
+    }
+    template <typename function>
+    Model apply(function func) const
+    {
+        Model result;
+        for (const Item &item : items)
+        {
+            result.insert(func(item));
+        }
+        return result;
+    }
+    Trace trace() const
+    {
+        return ::trace(items);
+    }
+};
+
+static bool keepEven(const Item &item)
+{
+    return item.key % 2 == 0;
+}
+
+static Item fold(const Item &item)
+{
+    return Item{item.key % 7, item.id};
+}
+
+template <class Iterator>
+static Iterator advanced(Iterator it, int steps)
+{
+    for (int i = 0; i < steps; ++i)
+    {
+        ++it;
+    }
+    return it;
+}
+
+/*=======================================================================*/
+/*=============================== checks ================================*/
+/*=======================================================================*/
+
+/**
+ * @brief element whose copies start throwing after a number of copies
+ */
+struct Fragile
+{
+    int value;
+    static int copies_left;
+    static int alive;
+
+    explicit Fragile(int value) : value(value)
+    {
+        alive++;
+    }
+    Fragile(const Fragile &other) : value(other.value)
+    {
+        if (copies_left-- <= 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        alive++;
+    }
+    ~Fragile()
+    {
+        alive--;
+    }
+    bool operator<(const Fragile &other) const
+    {
+        return value < other.value;
+    }
+};
+
+int Fragile::copies_left = 0;
+int Fragile::alive = 0;
+
+/**
+ * @brief user-012: lists on a shared NodePool behave like the original list, and copies are exception safe
+ */
+static void checkNodePool(std::mt19937 &random)
+{
+    NodePool<Item> pool;
+    SortedList<Item> plain;
+    SortedList<Item, NodePool<Item>> pooled(pool);
+    SortedList<Item, NodePool<Item>> neighbour(pool);
+    Model model;
+    bool removes_return_next = true;
+    for (const Item &item : randomItems(random, 3000, 100))
+    {
+        if (model.items.empty() || random() % 3 != 0)
+        {
+            plain.insert(item);
+            pooled.insert(item);
+            neighbour.insert(item);
+            model.insert(item);
+            continue;
+        }
+        int index = (int)(random() % model.items.size());
+        model.items.erase(model.items.begin() + index);
+        SortedList<Item>::const_iterator plain_next = plain.remove(advanced(plain.begin(), index));
+        SortedList<Item, NodePool<Item>>::const_iterator pooled_next = pooled.remove(advanced(pooled.begin(), index));
+        if (index == (int)model.items.size())
+        {
+            removes_return_next &= plain_next == plain.end() && pooled_next == pooled.end();
+        }
+        else
+        {
+            removes_return_next &= (*plain_next).id == model.items[index].id &&
+                                   (*pooled_next).id == model.items[index].id;
+        }
+    }
+    check("user-012 lists on a NodePool match the original list", trace(plain) == model.trace() &&
+                                                                   trace(pooled) == model.trace());
+    check("user-012 remove returns the element after the removed one", removes_return_next);
+    check("user-012 filter and apply on a NodePool list", trace(pooled.filter(keepEven)) == model.filter(keepEven).trace() &&
+                                                          trace(pooled.apply(fold)) == model.apply(fold).trace());
+
+    SortedList<Item, NodePool<Item>> copy(pooled);
+    copy.remove_if(keepEven);
+    neighbour = copy;
+    Trace odd = model.filter([](const Item &item)
+                             { return !keepEven(item); })
+                    .trace();
+    check("user-012 copies of a pooled list are independent", trace(pooled) == model.trace() && trace(neighbour) == odd);
+
+    bool unchanged = true;
+    {
+        SortedList<Fragile, NodePool<Fragile>> source;
+        SortedList<Fragile, NodePool<Fragile>> target;
+        Fragile::copies_left = 1000;
+        for (int i = 0; i < 100; ++i)
+        {
+            source.insert(Fragile(i));
+        }
+        target.insert(Fragile(-1));
+        int alive = Fragile::alive;
+        Fragile::copies_left = 50;
+        try
+        {
+            SortedList<Fragile, NodePool<Fragile>> copy(source);
+            unchanged = false;
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        Fragile::copies_left = 50;
+        try
+        {
+            target = source;
+            unchanged = false;
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        unchanged &= Fragile::alive == alive && target.length() == 1 && (*target.begin()).value == -1;
+    }
+    check("user-012 a throwing copy leaks nothing and leaves the target as it was", unchanged && Fragile::alive == 0);
+}
+
+/**
+ * @brief user-013: bulk construction, range insert and merge give the list that inserting one by one gives
+ */
+static void checkBulk(std::mt19937 &random)
+{
+    std::vector<Item> input = randomItems(random, 2000, 50);
+    std::vector<Item> sorted_input = input;
+    std::stable_sort(sorted_input.begin(), sorted_input.end());
+    std::vector<Item> reverse_input(sorted_input.rbegin(), sorted_input.rend());
+    bool same = true;
+    for (const std::vector<Item> *order : {&input, &sorted_input, &reverse_input})
+    {
+        Model model;
+        for (const Item &item : *order)
+        {
+            model.insert(item);
+        }
+        same &= trace(SortedList<Item>(order->begin(), order->end())) == model.trace();
+    }
+    check("user-013 range constructor matches inserting one by one", same);
+
+    std::vector<Item> first = randomItems(random, 500, 50);
+    std::vector<Item> second = randomItems(random, 500, 50);
+    Model model;
+    for (const Item &item : first)
+    {
+        model.insert(item);
+    }
+    for (const Item &item : second)
+    {
+        model.insert(item);
+    }
+    SortedList<Item> inserted(first.begin(), first.end());
+    inserted.insert(second.begin(), second.end());
+    SortedList<Item> merged(first.begin(), first.end());
+    merged.merge(SortedList<Item>(second.begin(), second.end()));
+    check("user-013 range insert puts new elements after the equal ones", trace(inserted) == model.trace());
+    check("user-013 merge is stable", trace(merged) == model.trace());
+
+    SortedList<Item> appended;
+    Item::comparisons = 0;
+    for (const Item &item : sorted_input)
+    {
+        appended.insert(item);
+    }
+    bool constant_appends = Item::comparisons <= sorted_input.size();
+    Item::comparisons = 0;
+    SortedList<Item> built(sorted_input.begin(), sorted_input.end());
+    bool linear_build = Item::comparisons <= 2 * sorted_input.size();
+    check("user-013 elements not smaller than the last are appended with one comparison",
+          constant_appends && trace(appended) == trace(sorted_input));
+    check("user-013 a sorted range is built with a linear number of comparisons",
+          linear_build && trace(built) == trace(sorted_input));
+}
+
+/**
+ * @brief user-014: a view pipeline gives what the chained filter and apply of the original list give,
+ * and visits the results in sorted order
+ */
+static void checkViews(std::mt19937 &random)
+{
+    std::vector<Item> input = randomItems(random, 2000, 100);
+    SortedList<Item> list(input.begin(), input.end());
+    Model model;
+    for (const Item &item : input)
+    {
+        model.insert(item);
+    }
+    auto shift = [](const Item &item)
+    { return Item{item.key + 1000, item.id}; };
+
+    Trace visited;
+    mtm::view(list).filter(keepEven).apply(fold).forEach([&visited](const Item &item)
+                                                         { visited.push_back(std::make_pair(item.key, item.id)); });
+    Trace expected = model.filter(keepEven).apply(fold).trace();
+    check("user-014 filter then apply collects like the original list",
+          trace(mtm::view(list).filter(keepEven).apply(fold).collect()) == expected);
+    check("user-014 forEach visits the results in sorted order", visited == expected);
+    check("user-014 apply then filter collects like the original list",
+          trace(mtm::view(list).apply(fold).filter(keepEven).collect()) == model.apply(fold).filter(keepEven).trace());
+    check("user-014 an order preserving apply keeps the list order",
+          trace(mtm::view(list).apply(shift, mtm::ORDER_PRESERVING).filter(keepEven).collect()) ==
+              model.apply(shift).filter(keepEven).trace());
+
+    NodePool<Item> pool;
+    SortedList<Item, NodePool<Item>> pooled(input.begin(), input.end(), pool);
+    SortedList<Item, NodePool<Item>> pooled_results = mtm::view(pooled).filter(keepEven).apply(fold).collect();
+    SortedList<int, NodePool<int>> keys = mtm::view(pooled).apply([](const Item &item)
+                                                                  { return item.key; })
+                                              .collect();
+    std::vector<int> expected_keys;
+    for (const Item &item : model.items)
+    {
+        expected_keys.push_back(item.key);
+    }
+    std::vector<int> collected_keys;
+    for (int key : keys)
+    {
+        collected_keys.push_back(key);
+    }
+    check("user-014 a pipeline over a pooled list collects into the same pool",
+          pooled_results.get_allocator() == pool && keys.get_allocator() == pool &&
+              trace(pooled_results) == expected && collected_keys == expected_keys);
+}
+
+/**
+ * @brief the original ExamDetails: the fields as given, the checks of the original constructor
+ * and its printing and operator-, ordered by date and then hour (as its operator< was documented).
+ */
+struct ExamModel
+{
+    enum Outcome
+    {
+        VALID,
+        INVALID_ARGS,
+        INVALID_DATE,
+        INVALID_TIME
+    };
+
+    int course_number, month, day;
+    double hour;
+    int length;
+    std::string zoom_link;
+
+    Outcome outcome() const
+    {
+        if (course_number <= 0)
+        {
+            return INVALID_ARGS;
+        }
+        if (month <= 0 || month > 12 || day <= 0 || day > 30)
+        {
+            return INVALID_DATE;
+        }
+        if ((hour < 0 || hour > 23.5) || ((hour - (int)hour != 0) && (hour - (int)hour != 0.5)) || length <= 0)
+        {
+            return INVALID_TIME;
+        }
+        return VALID;
+    }
+    bool before(const ExamModel &exam) const
+    {
+        if (month != exam.month)
+        {
+            return month < exam.month;
+        }
+        return day != exam.day ? day < exam.day : hour < exam.hour;
+    }
+    int minus(const ExamModel &exam) const
+    {
+        return (month - exam.month) * 30 + (day - exam.day);
+    }
+    std::string print() const
+    {
+        std::ostringstream os;
+        os << "Course Number: " << course_number << std::endl;
+        os << "Time: " << day << "." << month << " at ";
+        os << (int)hour << ((hour - (int)hour) == 0 ? ":00" : ":30") << std::endl;
+        os << "Duration: " << length << ":00" << std::endl;
+        os << "Zoom Link: " << zoom_link << std::endl;
+        return os.str();
+    }
+    ExamDetails make() const
+    {
+        return ExamDetails(course_number, month, day, hour, length, zoom_link);
+    }
+    /**
+     * @return the half hours from the start of the year to the start of the exam
+     */
+    long long start() const
+    {
+        return ((month - 1) * 30 + (day - 1)) * 48LL + (int)(hour * 2);
+    }
+};
+
+/**
+ * @brief mostly valid exam fields, with every kind of invalid field now and then
+ */
+static ExamModel randomExam(std::mt19937 &random, int index)
+{
+    static const double hours[] = {-0.5, 0, 0.5, 12.25, 23.5, 24, 7.75};
+    bool invalid = random() % 4 == 0;
+    ExamModel exam = {1 + (int)(random() % 9999), 1 + (int)(random() % 12), 1 + (int)(random() % 30),
+                      (random() % 48) / 2.0, 1 + (int)(random() % 5), "https://tinyurl.com/" + std::to_string(index)};
+    if (invalid)
+    {
+        exam.course_number -= random() % 2 == 0 ? 0 : 10000;
+        exam.month += random() % 3 == 0 ? 12 : 0;
+        exam.day -= random() % 3 == 0 ? 30 : 0;
+        exam.hour = hours[random() % 7];
+        exam.length -= random() % 3 == 0 ? 5 : 0;
+    }
+    return exam;
+}
+
+static ExamModel randomValidExam(std::mt19937 &random, int index)
+{
+    ExamModel exam = randomExam(random, index);
+    while (exam.outcome() != ExamModel::VALID)
+    {
+        exam = randomExam(random, index);
+    }
+    return exam;
+}
+
+/**
+ * @return the outcome of constructing the exam, by the exception thrown
+ */
+static ExamModel::Outcome construct(const ExamModel &exam)
+{
+    try
+    {
+        exam.make();
+        return ExamModel::VALID;
+    }
+    catch (const ExamDetails::InvalidArgsException &)
+    {
+        return ExamModel::INVALID_ARGS;
+    }
+    catch (const ExamDetails::InvalidDateException &)
+    {
+        return ExamModel::INVALID_DATE;
+    }
+    catch (const ExamDetails::InvalidTimeException &)
+    {
+        return ExamModel::INVALID_TIME;
+    }
+}
+
+/**
+ * @brief user-016: the packed ExamDetails checks, prints, subtracts and orders exams like the original
+ */
+static void checkPackedExams(std::mt19937 &random)
+{
+    std::vector<ExamModel> models;
+    bool same_outcomes = true;
+    bool same_prints = true;
+    for (int i = 0; i < 5000; ++i)
+    {
+        ExamModel model = randomExam(random, i);
+        ExamModel::Outcome outcome = construct(model);
+        same_outcomes &= outcome == model.outcome();
+        if (outcome == ExamModel::VALID)
+        {
+            std::ostringstream os;
+            os << model.make();
+            same_prints &= os.str() == model.print();
+            models.push_back(model);
+        }
+    }
+    check("user-016 the constructor throws what the original threw", same_outcomes);
+    check("user-016 exams print like the original", same_prints);
+
+    bool same_order = true;
+    bool same_difference = true;
+    for (int i = 0; i + 1 < (int)models.size(); ++i)
+    {
+        const ExamModel &first = models[i];
+        const ExamModel &second = models[i + 1];
+        same_order &= (first.make() < second.make()) == first.before(second) &&
+                      (second.make() < first.make()) == second.before(first);
+        same_difference &= first.make() - second.make() == first.minus(second);
+    }
+    check("user-016 operator< orders by date and then hour", same_order);
+    check("user-016 operator- gives the original difference in days", same_difference);
+
+    std::vector<ExamModel> expected = models;
+    std::stable_sort(expected.begin(), expected.end(), [](const ExamModel &first, const ExamModel &second)
+                     { return first.before(second); });
+    SortedList<ExamDetails> list;
+    for (const ExamModel &model : models)
+    {
+        list.insert(model.make());
+    }
+    bool same_list = list.length() == (int)expected.size();
+    SortedList<ExamDetails>::const_iterator it = list.begin();
+    for (int i = 0; same_list && i < (int)expected.size(); ++i, ++it)
+    {
+        same_list = (*it).getLink() == expected[i].zoom_link;
+    }
+    check("user-016 a SortedList of exams is in time order, equal times in insertion order", same_list);
+}
+
+/**
+ * @brief user-017: interned links are shared between equal links and read like the original copied strings
+ */
+static void checkInternedLinks(std::mt19937 &random)
+{
+    mtm::StringPool pool;
+    std::set<std::string> distinct;
+    bool shared = true;
+    for (int i = 0; i < 3000; ++i)
+    {
+        std::string link = "https://tinyurl.com/" + std::to_string(random() % 500);
+        const std::string &interned = pool.intern(link);
+        shared &= interned == link && &interned == &pool.intern(std::string(link));
+        distinct.insert(link);
+    }
+    check("user-017 the pool keeps every distinct string once", shared && pool.size() == (int)distinct.size());
+
+    std::vector<ExamDetails> exams;
+    std::vector<std::string> links;
+    for (int i = 0; i < 1000; ++i)
+    {
+        links.push_back("https://zoom.us/" + std::to_string(random() % 50));
+        exams.push_back(ExamDetails(1 + i, 1 + i % 12, 1 + i % 30, 10, 2, links.back()));
+    }
+    bool same_links = true;
+    for (int i = 0; i < 1000; ++i)
+    {
+        int other = (int)(random() % 1000);
+        same_links &= exams[i].getLink() == links[i] &&
+                      (&exams[i].getLink() == &exams[other].getLink()) == (links[i] == links[other]);
+    }
+    ExamDetails copy = exams[0];
+    copy.setLink(links[0] + "/changed");
+    same_links &= exams[0].getLink() == links[0] && copy.getLink() == links[0] + "/changed";
+    check("user-017 exams with equal links share them and setLink changes only its exam", same_links);
+}
+
+/**
+ * @brief true if the calendar has the printouts of the exams, in the same order
+ */
+static bool sameExams(const mtm::ExamCalendar &calendar, const std::vector<ExamModel> &exams)
+{
+    if (calendar.size() != (int)exams.size())
+    {
+        return false;
+    }
+    for (int i = 0; i < calendar.size(); ++i)
+    {
+        std::ostringstream os;
+        os << calendar[i];
+        if (os.str() != exams[i].print())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief indexes of the exams (sorted by time) that take place in any part of the window, by a scan of all of them
+ */
+static std::vector<int> overlappingModels(const std::vector<ExamModel> &sorted, const ExamModel &window)
+{
+    std::vector<int> found;
+    for (int i = 0; i < (int)sorted.size(); ++i)
+    {
+        long long start = sorted[i].start();
+        if (start < window.start() + 2LL * window.length && window.start() < start + 2LL * sorted[i].length)
+        {
+            found.push_back(i);
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief user-018: the calendar keeps the order of a SortedList of the exams and answers its queries
+ * like a scan of all the exams
+ */
+static void checkCalendar(std::mt19937 &random)
+{
+    std::vector<ExamModel> models;
+    std::vector<ExamDetails> exams;
+    for (int i = 0; i < 2000; ++i)
+    {
+        models.push_back(randomValidExam(random, i));
+        exams.push_back(models.back().make());
+    }
+    models.push_back(ExamModel{1, 1, 1, 0, 2000000000, "all year"});
+    exams.push_back(models.back().make());
+    std::vector<ExamModel> sorted = models;
+    std::stable_sort(sorted.begin(), sorted.end(), [](const ExamModel &first, const ExamModel &second)
+                     { return first.before(second); });
+    mtm::ExamCalendar calendar(exams.begin(), exams.end());
+    mtm::ExamCalendar inserted;
+    for (const ExamDetails &exam : exams)
+    {
+        inserted.insert(exam);
+    }
+    check("user-018 the calendar has the exams in SortedList order", sameExams(calendar, sorted) &&
+                                                                      sameExams(inserted, sorted));
+
+    bool same_windows = true;
+    bool same_days = true;
+    for (int query = 0; query < 500; ++query)
+    {
+        ExamModel window = randomValidExam(random, -1);
+        window.length = 1 + (int)(random() % 30);
+        std::vector<int> expected = overlappingModels(sorted, window);
+        std::vector<int> expected_day;
+        for (int i = 0; i < (int)sorted.size(); ++i)
+        {
+            if (sorted[i].month == window.month && sorted[i].day == window.day)
+            {
+                expected_day.push_back(i);
+            }
+        }
+        same_windows &= calendar.overlapping(window.month, window.day, window.hour, window.length) == expected &&
+                        calendar.overlapping(window.make()) == expected;
+        same_days &= calendar.startingOn(window.month, window.day) == expected_day;
+    }
+    check("user-018 overlapping finds what a scan of the exams finds", same_windows);
+    check("user-018 startingOn finds the exams of the day", same_days);
+
+    for (int i = 0; i < 500; ++i)
+    {
+        int index = (int)(random() % sorted.size());
+        sorted.erase(sorted.begin() + index);
+        calendar.erase(index);
+    }
+    check("user-018 erase removes the exam at the index", sameExams(calendar, sorted));
+
+    std::vector<ExamModel> short_models;
+    std::vector<ExamDetails> short_exams;
+    for (int i = 0; i < 100000; ++i)
+    {
+        short_models.push_back(randomValidExam(random, i));
+        short_models.back().length = 1 + (int)(random() % 4);
+        short_exams.push_back(short_models.back().make());
+    }
+    mtm::ExamCalendar only_short(short_exams.begin(), short_exams.end());
+    mtm::ExamCalendar mixed(short_exams.begin(), short_exams.end());
+    std::vector<ExamModel> mixed_models = short_models;
+    std::stable_sort(mixed_models.begin(), mixed_models.end(), [](const ExamModel &first, const ExamModel &second)
+                     { return first.before(second); });
+    ExamModel long_exam = {2, 1, 1, 0, 24 * 300, "most of the year"};
+    mixed.insert(long_exam.make());
+    mixed_models.insert(std::upper_bound(mixed_models.begin(), mixed_models.end(), long_exam,
+                                         [](const ExamModel &first, const ExamModel &second)
+                                         { return first.before(second); }),
+                        long_exam);
+    std::vector<ExamModel> windows;
+    for (int query = 0; query < 2000; ++query)
+    {
+        windows.push_back(randomValidExam(random, -1));
+    }
+    std::size_t found_short = 0, found_mixed = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (const ExamModel &window : windows)
+    {
+        found_short += only_short.overlapping(window.month, window.day, window.hour, window.length).size();
+    }
+    std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+    for (const ExamModel &window : windows)
+    {
+        found_mixed += mixed.overlapping(window.month, window.day, window.hour, window.length).size();
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    bool same_mixed = sameExams(mixed, mixed_models);
+    for (int query = 0; query < 20; ++query)
+    {
+        const ExamModel &window = windows[query];
+        same_mixed &= mixed.overlapping(window.make()) == overlappingModels(mixed_models, window);
+    }
+    double short_ms = std::chrono::duration<double, std::milli>(middle - start).count();
+    double mixed_ms = std::chrono::duration<double, std::milli>(end - middle).count();
+    check("user-018 one long exam among many short ones is found without scanning the short ones",
+          same_mixed && found_mixed >= found_short && mixed_ms < 10 * short_ms + 5);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        int index = (int)(random() % mixed_models.size());
+        mixed_models.erase(mixed_models.begin() + index);
+        mixed.erase(index);
+    }
+    bool same_after_erase = sameExams(mixed, mixed_models);
+    for (int query = 0; query < 20; ++query)
+    {
+        const ExamModel &window = windows[query];
+        same_after_erase &= mixed.overlapping(window.make()) == overlappingModels(mixed_models, window);
+    }
+    check("user-018 erasing from a calendar with a long exam keeps the windows right", same_after_erase);
+}
+
+/**
+ * @brief user-019: the batch accepts and rejects the rows the constructor accepts and rejects,
+ * and builds the same exams
+ */
+static void checkBatch(std::mt19937 &random)
+{
+    static const double odd_hours[] = {std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                                       1e300, -1e300, 23.50001, -0.0};
+    mtm::ExamBatch batch;
+    std::vector<ExamModel> rows;
+    for (int i = 0; i < 5000; ++i)
+    {
+        ExamModel row = randomExam(random, i);
+        if (random() % 50 == 0)
+        {
+            row.hour = odd_hours[random() % 6];
+        }
+        rows.push_back(row);
+        batch.add(row.course_number, row.month, row.day, row.hour, row.length, row.zoom_link);
+    }
+    std::vector<ExamDetails> built;
+    std::vector<mtm::ExamStatus> statuses = batch.build(built);
+    bool same_statuses = statuses.size() == rows.size() && statuses == batch.validate();
+    bool same_exams = true;
+    std::size_t next = 0;
+    for (std::size_t i = 0; same_statuses && i < rows.size(); ++i)
+    {
+        ExamModel::Outcome outcome = construct(rows[i]);
+        same_statuses = (int)statuses[i] == (int)outcome;
+        if (outcome != ExamModel::VALID)
+        {
+            continue;
+        }
+        std::ostringstream expected;
+        std::ostringstream actual;
+        expected << rows[i].make();
+        if (next < built.size())
+        {
+            actual << built[next];
+        }
+        same_exams &= next < built.size() && actual.str() == expected.str() && !(built[next] < rows[i].make()) &&
+                      !(rows[i].make() < built[next]);
+        next++;
+    }
+    check("user-019 every row gets the status of the constructor outcome", same_statuses);
+    check("user-019 the valid rows build the exams the constructor builds", same_exams && next == built.size());
+}
+
+template <class T>
+static std::vector<T> elementsOf(const SortedList<T> &list)
+{
+    std::vector<T> elements;
+    for (const T &element : list)
+    {
+        elements.push_back(element);
+    }
+    return elements;
+}
+
+static std::vector<std::string> printed(const SortedList<ExamDetails> &list)
+{
+    std::vector<std::string> result;
+    for (const ExamDetails &exam : list)
+    {
+        std::ostringstream os;
+        os << exam;
+        result.push_back(os.str());
+    }
+    return result;
+}
+
+/**
+ * @return true if reading the bytes throws BinaryFormatError
+ */
+static bool rejected(const std::string &bytes)
+{
+    std::istringstream is(bytes);
+    try
+    {
+        mtm::readSortedList<ExamDetails>(is);
+    }
+    catch (const mtm::BinaryFormatError &)
+    {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief sets the bytes at the offset to the little endian value
+ */
+static std::string patched(std::string bytes, std::size_t offset, unsigned long long value, int size)
+{
+    for (int i = 0; i < size; ++i)
+    {
+        bytes[offset + i] = (char)(value >> (8 * i));
+    }
+    return bytes;
+}
+
+/**
+ * @brief user-020: lists read back equal to the written ones, cut and corrupt data throws BinaryFormatError
+ */
+static void checkSerialization(std::mt19937 &random)
+{
+    std::vector<int> numbers;
+    std::vector<std::string> strings;
+    std::vector<ExamDetails> exams;
+    for (int i = 0; i < 3000; ++i)
+    {
+        numbers.push_back((int)(random() % 2000001) - 1000000);
+        strings.push_back(std::string(random() % 20, (char)('a' + random() % 26)));
+        exams.push_back(randomValidExam(random, i % 100).make());
+    }
+    SortedList<int> number_list(numbers.begin(), numbers.end());
+    SortedList<std::string> string_list(strings.begin(), strings.end());
+    SortedList<ExamDetails> exam_list(exams.begin(), exams.end());
+    std::stringstream number_stream, string_stream, exam_stream;
+    mtm::writeSortedList(number_stream, number_list);
+    mtm::writeSortedList(string_stream, string_list);
+    mtm::writeSortedList(exam_stream, exam_list);
+    check("user-020 lists read from a stream equal the written lists",
+          elementsOf(mtm::readSortedList<int>(number_stream)) == elementsOf(number_list) &&
+              elementsOf(mtm::readSortedList<std::string>(string_stream)) == elementsOf(string_list) &&
+              printed(mtm::readSortedList<ExamDetails>(exam_stream)) == printed(exam_list));
+
+    const std::string path = "behaviourTest.bin";
+    mtm::writeSortedListFile(path, exam_list);
+    bool same_file = printed(mtm::readSortedListFile<ExamDetails>(path)) == printed(exam_list) &&
+                     mtm::readSortedListFile<ExamDetails, NodePool<ExamDetails>>(path).length() == exam_list.length();
+    std::remove(path.c_str());
+    check("user-020 lists read from a file equal the written lists", same_file);
+
+    SortedList<ExamDetails> small;
+    small.insert(ExamDetails::makeMatamExam());
+    small.insert(ExamDetails(104031, 2, 14, 9.5, 2, "https://tinyurl.com/dnb"));
+    std::ostringstream small_stream;
+    mtm::writeSortedList(small_stream, small);
+    const std::string bytes = small_stream.str();
+    bool cut_rejected = true;
+    for (std::size_t cut = 0; cut < bytes.size(); ++cut)
+    {
+        cut_rejected &= rejected(bytes.substr(0, cut));
+    }
+    check("user-020 data cut at any byte is rejected", cut_rejected);
+
+    const std::size_t header = 16;
+    const std::size_t first_link_length = header + 4 + 4 + 2;
+    check("user-020 a bad header is rejected", rejected("XTSL" + bytes.substr(4)) && rejected(patched(bytes, 4, 2, 2)) &&
+                                                   rejected(patched(bytes, 8, 1000000000000ull, 8)));
+    check("user-020 a string longer than the data is rejected before it is allocated",
+          rejected(patched(bytes, first_link_length, 0xffffffffu, 4)) &&
+              rejected(patched(bytes, first_link_length, bytes.size(), 4)));
+    check("user-020 an exam record out of range is rejected",
+          rejected(patched(bytes, header, 0, 4)) && rejected(patched(bytes, header + 4, (unsigned)-3, 4)) &&
+              rejected(patched(bytes, header + 8, ExamDetails::SLOTS_PER_YEAR, 2)));
+
+    bool flips_handled = true;
+    for (int i = 0; i < 3000; ++i)
+    {
+        std::string corrupt = bytes;
+        corrupt[random() % corrupt.size()] ^= (char)(1 << (random() % 8));
+        std::istringstream is(corrupt);
+        try
+        {
+            flips_handled &= mtm::readSortedList<ExamDetails>(is).length() <= small.length();
+        }
+        catch (const mtm::BinaryFormatError &)
+        {
+        }
+    }
+    check("user-020 flipped bits give BinaryFormatError or no more than the written records", flips_handled);
+}
+
+/**
+ * @brief user-021: single threaded the concurrent list acts like the original list, snapshots dont
+ * change after they are taken, and readers running with writers always see sorted versions
+ */
+static void checkConcurrent(std::mt19937 &random)
+{
+    mtm::ConcurrentSortedList<Item> list;
+    Model model;
+    bool same_removes = true;
+    for (const Item &item : randomItems(random, 1000, 50))
+    {
+        if (random() % 4 != 0)
+        {
+            list.insert(item);
+            model.insert(item);
+            continue;
+        }
+        Item key = {item.key, -1};
+        std::vector<Item>::iterator found = std::lower_bound(model.items.begin(), model.items.end(), key);
+        bool present = found != model.items.end() && !(key < *found);
+        if (present)
+        {
+            model.items.erase(found);
+        }
+        same_removes &= list.remove(key) == present;
+    }
+    mtm::ConcurrentSortedList<Item>::Snapshot before = list.snapshot();
+    Trace before_trace = trace(before);
+    int removed = list.remove_if(keepEven);
+    list.update([](SortedList<Item> &version)
+                { version.insert(Item{1, -2}); });
+    Model expected = model.filter([](const Item &item)
+                                  { return !keepEven(item); });
+    expected.insert(Item{1, -2});
+    check("user-021 single threaded it acts like the original list",
+          same_removes && trace(list.snapshot()) == expected.trace() &&
+              removed == (int)(model.items.size() - expected.items.size() + 1));
+    check("user-021 a snapshot doesnt change after it is taken", trace(before) == before_trace &&
+                                                                 before_trace == model.trace());
+
+    mtm::ConcurrentSortedList<Item> shared;
+    const int writes = 2000;
+    bool readers_ok = true;
+    std::thread writer([&shared]()
+                       {
+                           for (int i = 0; i < writes; ++i)
+                           {
+                               shared.insert(Item{(i * 7919) % 1000, i});
+                           }
+                       });
+    std::thread reader([&shared, &readers_ok]()
+                       {
+                           int last_length = 0;
+                           while (last_length < writes)
+                           {
+                               mtm::ConcurrentSortedList<Item>::Snapshot version = shared.snapshot();
+                               Trace items = trace(version);
+                               readers_ok &= (int)items.size() == version.length() && last_length <= version.length() &&
+                                             std::is_sorted(items.begin(), items.end(),
+                                                            [](const std::pair<int, int> &first, const std::pair<int, int> &second)
+                                                            { return first.first < second.first; });
+                               last_length = version.length();
+                           }
+                       });
+    writer.join();
+    reader.join();
+    check("user-021 readers see whole sorted versions while a writer inserts", readers_ok && shared.length() == writes);
+}
+
+/**
+ * @brief user-022: every version of the persistent list matches the model of the version it was copied from
+ * plus its own changes, so changing a copy never changes the others, and iterators of old versions still
+ * walk their versions
+ */
+static void checkPersistent(std::mt19937 &random)
+{
+    typedef mtm::PersistentSortedList<Item> List;
+    std::vector<Item> input = randomItems(random, 300, 40);
+    std::vector<List> versions(1, List(input.begin(), input.end()));
+    std::vector<Model> models(1);
+    for (const Item &item : input)
+    {
+        models[0].insert(item);
+    }
+    List::const_iterator first_middle = advanced(versions[0].begin(), versions[0].length() / 2);
+    Trace first_tail = models[0].trace();
+    first_tail.erase(first_tail.begin(), first_tail.begin() + first_tail.size() / 2);
+    bool same_removes = true;
+    for (int step = 0; step < 400; ++step)
+    {
+        int from = (int)(random() % versions.size());
+        List list = versions[from];
+        Model model = models[from];
+        int divisor = 2 + (int)(random() % 5);
+        auto divisible = [divisor](const Item &item)
+        { return item.key % divisor == 0; };
+        switch (random() % 5)
+        {
+        case 0:
+        {
+            Item item = {(int)(random() % 40), 1000 + step};
+            list.insert(item);
+            model.insert(item);
+            break;
+        }
+        case 1:
+            if (model.items.size() > 0)
+            {
+                int index = (int)(random() % model.items.size());
+                List::const_iterator next = list.remove(advanced(list.begin(), index));
+                model.items.erase(model.items.begin() + index);
+                same_removes &= next == advanced(list.begin(), index);
+            }
+            break;
+        case 2:
+        {
+            int removed = list.remove_if(divisible);
+            Model kept = model.filter([&divisible](const Item &item)
+                                      { return !divisible(item); });
+            same_removes &= removed == (int)(model.items.size() - kept.items.size());
+            model = kept;
+            break;
+        }
+        case 3:
+            list = list.filter(divisible);
+            model = model.filter(divisible);
+            break;
+        default:
+            list = list.apply(fold);
+            model = model.apply(fold);
+            break;
+        }
+        versions.push_back(list);
+        models.push_back(model);
+    }
+    bool same = true;
+    for (std::size_t i = 0; i < versions.size(); ++i)
+    {
+        same &= trace(versions[i]) == models[i].trace() && versions[i].length() == (int)models[i].items.size();
+    }
+    check("user-022 every version matches its model after changes to the copies", same && same_removes);
+
+    Trace walked;
+    for (List::const_iterator it = first_middle; it != versions[0].end(); ++it)
+    {
+        walked.push_back(std::make_pair((*it).key, (*it).id));
+    }
+    List copy = versions[0];
+    copy.insert(Item{0, -1});
+    check("user-022 iterators of a version stay valid and differ from the iterators of its copies",
+          walked == first_tail && versions[0].begin() != copy.begin() && versions[0].end() != copy.end());
+
+    List same_version = versions[0];
+    Trace before_removes = trace(copy);
+    bool rejected_old = false;
+    try
+    {
+        copy.remove(first_middle);
+    }
+    catch (const std::invalid_argument &)
+    {
+        rejected_old = true;
+    }
+    Model shared = models[0];
+    same_version.remove(first_middle);
+    shared.items.erase(shared.items.begin() + shared.items.size() / 2);
+    check("user-022 remove rejects an iterator of another version and takes one of an unchanged copy",
+          rejected_old && trace(copy) == before_removes && trace(same_version) == shared.trace() &&
+              trace(versions[0]) == models[0].trace());
+}
+
+/**
+ * @brief user-011: the skip list and the original list go through the same random changes and always
+ * hold the same elements in the same order, and the lookups agree with a search of the model
+ */
+static void checkSkipList(std::mt19937 &random)
+{
+    mtm::SortedSkipList<Item> skip;
+    SortedList<Item> list;
+    Model model;
+    bool same_steps = true;
+    for (int step = 0; step < 3000; ++step)
+    {
+        switch (random() % 4)
+        {
+        case 0:
+        case 1:
+        {
+            Item item = {(int)(random() % 200), step};
+            skip.insert(item);
+            list.insert(item);
+            model.insert(item);
+            break;
+        }
+        case 2:
+            if (model.items.size() > 0)
+            {
+                int index = (int)(random() % model.items.size());
+                mtm::SortedSkipList<Item>::const_iterator next = skip.remove(advanced(skip.begin(), index));
+                SortedList<Item>::const_iterator list_next = list.remove(advanced(list.begin(), index));
+                model.items.erase(model.items.begin() + index);
+                same_steps &= (next == skip.end()) == (list_next == list.end()) &&
+                              (next == skip.end() || ((*next).id == (*list_next).id &&
+                                                      (*next).id == model.items[index].id));
+            }
+            break;
+        default:
+        {
+            Item key = {(int)(random() % 200), -1};
+            std::vector<Item>::iterator first = std::lower_bound(model.items.begin(), model.items.end(), key);
+            mtm::SortedSkipList<Item>::const_iterator found = skip.lower_bound(key);
+            bool present = first != model.items.end() && !(key < *first);
+            same_steps &= (found == skip.end() ? first == model.items.end() : (*found).id == first->id) &&
+                          skip.contains(key) == present &&
+                          (present ? (*skip.find(key)).id == first->id : skip.find(key) == skip.end());
+            break;
+        }
+        }
+    }
+    check("user-011 insert, remove and lookups of the skip list match the original list",
+          same_steps && trace(skip) == trace(list) && trace(skip) == model.trace() &&
+              skip.length() == list.length());
+
+    mtm::SortedSkipList<Item> copy(skip);
+    SortedList<Item> list_copy(list);
+    copy.insert(Item{0, -2});
+    list_copy.insert(Item{0, -2});
+    int removed = skip.remove_if(keepEven);
+    int list_removed = list.remove_if(keepEven);
+    check("user-011 remove_if, filter and apply of the skip list match the original list",
+          removed == list_removed && trace(skip) == trace(list) &&
+              trace(copy.filter(keepEven)) == trace(list_copy.filter(keepEven)) &&
+              trace(copy.apply(fold)) == trace(list_copy.apply(fold)));
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int seed = argc > 1 ? (unsigned int)std::atoi(argv[1]) : 2021;
+    std::mt19937 random(seed);
+    std::cout << "seed " << seed << std::endl;
+    checkNodePool(random);
+    checkBulk(random);
+    checkViews(random);
+    checkPackedExams(random);
+    checkInternedLinks(random);
+    checkCalendar(random);
+    checkBatch(random);
+    checkSerialization(random);
+    checkConcurrent(random);
+    checkPersistent(random);
+    checkSkipList(random);
+    return failures;
+}
@@ -0,0 +1,134 @@
+/**
+ * Scaling of parallelFilter/parallelApply against the serial SortedList::filter/apply,
+ * with an expensive predicate over ExamDetails (and a cheap one for the stitching overhead).
+ *
+ * build and run from the "Generic Sorted List" directory:
+ *   g++ -std=c++11 -O2 -pthread -I. benchmark/parallelBenchmark.cpp examDetails.cpp stringPool.cpp -o parallelBenchmark
+ *   ./parallelBenchmark [exams] [max threads]
+ */
+#include "examDetails.h"
+#include "parallelSortedList.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using mtm::ExamDetails;
+using mtm::SortedList;
+
+/**
+ * @brief stands for a room-conflict check, a fixed amount of work per exam.
+ */
+static bool expensiveCheck(const ExamDetails &exam)
+{
+    unsigned int hash = 2166136261u;
+    const std::string &link = exam.getLink();
+    for (int round = 0; round < 200; ++round)
+    {
+        for (char c : link)
+        {
+            hash = (hash ^ (unsigned char)c) * 16777619u;
+        }
+    }
+    return hash % 3 != 0;
+}
+
+/**
+ * @brief the apply function, the same exam with a mark appended to its link.
+ */
+static ExamDetails markLink(const ExamDetails &exam)
+{
+    ExamDetails marked(exam);
+    marked.setLink(exam.getLink() + "#");
+    return marked;
+}
+
+/**
+ * @brief true if the lists have the same exams in the same order (every exam has its own link).
+ */
+static bool sameExams(const SortedList<ExamDetails> &list, const SortedList<ExamDetails> &other)
+{
+    if (list.length() != other.length())
+    {
+        return false;
+    }
+    SortedList<ExamDetails>::const_iterator other_it = other.begin();
+    for (const ExamDetails &exam : list)
+    {
+        const ExamDetails &other_exam = *other_it;
+        if (exam < other_exam || other_exam < exam || exam.getLink() != other_exam.getLink())
+        {
+            return false;
+        }
+        ++other_it;
+    }
+    return true;
+}
+
+/**
+ * @brief the thread counts to measure: the powers of two below max_threads, then max_threads itself.
+ */
+static std::vector<unsigned int> threadCounts(unsigned int max_threads)
+{
+    std::vector<unsigned int> counts;
+    for (unsigned int threads = 1; threads < max_threads; threads *= 2)
+    {
+        counts.push_back(threads);
+    }
+    counts.push_back(max_threads);
+    return counts;
+}
+
+template <typename runner>
+static double timeMs(runner run)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    run();
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int exams = argc > 1 ? std::atoi(argv[1]) : 100000;
+    unsigned int max_threads = argc > 2 ? (unsigned int)std::atoi(argv[2]) : std::thread::hardware_concurrency();
+    if (max_threads == 0)
+    {
+        max_threads = 1;
+    }
+    std::srand(2021);
+    std::vector<ExamDetails> input;
+    for (int i = 0; i < exams; ++i)
+    {
+        input.push_back(ExamDetails(104000 + std::rand() % 1000, 1 + std::rand() % 12, 1 + std::rand() % 30,
+                                    (std::rand() % 47) / 2.0, 1 + std::rand() % 4,
+                                   "https://tinyurl.com/exam" + std::to_string(i)));
+    }
+    SortedList<ExamDetails> list(input.begin(), input.end());
+    std::cout << exams << " exams, up to " << max_threads << " threads" << std::endl;
+
+    SortedList<ExamDetails> serial_filtered;
+    SortedList<ExamDetails> serial_applied;
+    double serial_filter = timeMs([&]()
+                                  { serial_filtered = list.filter(expensiveCheck); });
+    double serial_apply = timeMs([&]()
+                                 { serial_applied = list.apply(markLink); });
+    std::cout << "serial: filter " << serial_filter << " ms, apply " << serial_apply << " ms" << std::endl;
+    for (unsigned int threads : threadCounts(max_threads))
+    {
+        SortedList<ExamDetails> filtered;
+        SortedList<ExamDetails> applied;
+        double filter = timeMs([&]()
+                               { filtered = mtm::parallelFilter(list, expensiveCheck, threads); });
+        double apply = timeMs([&]()
+                              { applied = mtm::parallelApply(list, markLink, threads); });
+        bool same = sameExams(filtered, serial_filtered) && sameExams(applied, serial_applied);
+        std::cout << threads << " threads: filter " << filter << " ms (x" << serial_filter / filter << ")"
+                  << ", apply " << apply << " ms (x" << serial_apply / apply << ")"
+                  << (same ? "" : " MISMATCH") << std::endl;
+    }
+    return 0;
+}
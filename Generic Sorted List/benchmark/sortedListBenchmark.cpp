@@ -0,0 +1,291 @@
+/**
+ * Cost of the SortedList operations (insert, remove, iteration, copy, filter, apply) for
+ * SortedList<int>, SortedList<std::string> and SortedList<ExamDetails>, at sizes from 10 to 10^6,
+ * with the elements coming in random, sorted and reverse order.
+ * every case prints one line, JSON by default (--csv for CSV), with the time and the allocations
+ * per element and the peak RSS of the process so far, so runs can be diffed and tracked over time.
+ * inserting in random order is O(n^2), those cases are skipped above --quadratic-limit elements.
+ *
+ * build and run from the "Generic Sorted List" directory:
+ *   g++ -std=c++11 -O2 -I. benchmark/sortedListBenchmark.cpp examDetails.cpp stringPool.cpp -o sortedListBenchmark
+ *   ./sortedListBenchmark [--csv] [--max-size N] [--quadratic-limit N] > results.jsonl
+ */
+#include "examDetails.h"
+#include "sortedList.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+using mtm::ExamDetails;
+using mtm::SortedList;
+
+static unsigned long allocations = 0;
+
+void *operator new(std::size_t size)
+{
+    allocations++;
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+/**
+ * @brief peak resident set size of the process, in KB (Linux reports ru_maxrss in KB, macOS in bytes)
+ */
+static long peakRssKb()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+static bool csv = false;
+
+/**
+ * @brief prints the result of one case
+ */
+static void report(const char *type, int size, const char *order, const char *operation, double ns,
+                   double allocations_per_op)
+{
+    if (csv)
+    {
+        std::cout << type << ',' << size << ',' << order << ',' << operation << ',' << ns << ','
+                  << allocations_per_op << ',' << peakRssKb() << std::endl;
+        return;
+    }
+    std::cout << "{\"type\":\"" << type << "\",\"size\":" << size << ",\"order\":\"" << order
+              << "\",\"op\":\"" << operation << "\",\"ns_per_op\":" << ns
+              << ",\"allocs_per_op\":" << allocations_per_op << ",\"peak_rss_kb\":" << peakRssKb() << '}'
+              << std::endl;
+}
+
+/**
+ * @brief runs the case until about 50ms passed (at least once), every run does size operations.
+ * setup is called before every run and is not measured.
+ */
+static void measure(const char *type, int size, const char *order, const char *operation,
+                    const std::function<void()> &setup, const std::function<void()> &run)
+{
+    const double budget_ns = 50e6;
+    double total_ns = 0;
+    unsigned long total_allocations = 0;
+    long runs = 0;
+    while (runs == 0 || total_ns < budget_ns)
+    {
+        setup();
+        unsigned long allocations_before = allocations;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        run();
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        total_allocations += allocations - allocations_before;
+        total_ns += std::chrono::duration<double, std::nano>(end - start).count();
+        runs++;
+    }
+    double operations = (double)runs * (size == 0 ? 1 : size);
+    report(type, size, order, operation, total_ns / operations, total_allocations / operations);
+}
+
+/*=======================================================================*/
+/*============================ element types ============================*/
+/*=======================================================================*/
+
+/**
+ * @brief how to make random elements of a type, and the filter and apply functions used for it
+ */
+template <class T>
+struct Elements;
+
+template <>
+struct Elements<int>
+{
+    static const char *name() { return "int"; }
+    static int make(std::mt19937 &random, int) { return (int)(random() % 1000000000); }
+    static bool keep(const int &value) { return value % 2 == 0; }
+    static int change(const int &value) { return 1000000000 - value; }
+};
+
+template <>
+struct Elements<std::string>
+{
+    static const char *name() { return "string"; }
+    static std::string make(std::mt19937 &random, int)
+    {
+        std::string value(24, 'a');
+        for (char &c : value)
+        {
+            c = (char)('a' + random() % 26);
+        }
+        return value;
+    }
+    static bool keep(const std::string &value) { return value[0] < 'n'; }
+    static std::string change(const std::string &value) { return value.substr(1) + value[0]; }
+};
+
+template <>
+struct Elements<ExamDetails>
+{
+    static const char *name() { return "ExamDetails"; }
+    static ExamDetails make(std::mt19937 &random, int index)
+    {
+        return ExamDetails(104000 + random() % 1000, 1 + random() % 12, 1 + random() % 30,
+                           (random() % 48) / 2.0, 1 + random() % 4,
+                           "https://tinyurl.com/exam" + std::to_string(index % 1000));
+    }
+    static bool keep(const ExamDetails &exam) { return exam.getLink().size() % 2 == 0; }
+    static ExamDetails change(const ExamDetails &exam)
+    {
+        ExamDetails changed(exam);
+        changed.setLink(exam.getLink() + "#");
+        return changed;
+    }
+};
+
+/*=======================================================================*/
+/*================================ cases ================================*/
+/*=======================================================================*/
+
+enum Order
+{
+    RANDOM,
+    SORTED,
+    REVERSE
+};
+
+static const char *const ORDER_NAMES[] = {"random", "sorted", "reverse"};
+
+template <class T>
+static std::vector<T> makeInput(int size, Order order)
+{
+    std::mt19937 random(2021 + size);
+    std::vector<T> input;
+    input.reserve(size);
+    for (int i = 0; i < size; ++i)
+    {
+        input.push_back(Elements<T>::make(random, i));
+    }
+    if (order == SORTED)
+    {
+        std::stable_sort(input.begin(), input.end());
+    }
+    else if (order == REVERSE)
+    {
+        std::stable_sort(input.begin(), input.end());
+        std::reverse(input.begin(), input.end());
+    }
+    return input;
+}
+
+template <class T>
+static void benchmarkType(int max_size, int quadratic_limit)
+{
+    const char *type = Elements<T>::name();
+    for (int size = 10; size <= max_size; size *= 10)
+    {
+        for (int order = RANDOM; order <= REVERSE; ++order)
+        {
+            const char *order_name = ORDER_NAMES[order];
+            const std::vector<T> input = makeInput<T>(size, (Order)order);
+            SortedList<T> built(input.begin(), input.end());
+            SortedList<T> work;
+            std::size_t checksum = 0;
+            auto nothing = []() {};
+            auto reset = [&]()
+            { work = SortedList<T>(); };
+
+            if (order != RANDOM || size <= quadratic_limit)
+            {
+                measure(type, size, order_name, "insert", reset, [&]()
+                        {
+                            for (const T &element : input)
+                            {
+                                work.insert(element);
+                            }
+                        });
+            }
+            measure(type, size, order_name, "range_insert", reset, [&]()
+                    { work.insert(input.begin(), input.end()); });
+            measure(type, size, order_name, "remove", [&]()
+                    { work = built; },
+                    [&]()
+                    {
+                        while (work.length() > 0)
+                        {
+                            work.remove(work.begin());
+                        }
+                    });
+            measure(type, size, order_name, "iterate", nothing, [&]()
+                    {
+                        for (const T &element : built)
+                        {
+                            checksum += (std::size_t)&element >> 4;
+                        }
+                    });
+            measure(type, size, order_name, "copy", reset, [&]()
+                    { work = built; });
+            measure(type, size, order_name, "filter", nothing, [&]()
+                    { checksum += built.filter(Elements<T>::keep).length(); });
+            measure(type, size, order_name, "apply", nothing, [&]()
+                    { checksum += built.apply(Elements<T>::change).length(); });
+            if (checksum == 1)
+            {
+                std::cerr << checksum << std::endl;
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int max_size = 1000000;
+    int quadratic_limit = 10000;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--csv") == 0)
+        {
+            csv = true;
+        }
+        else if (std::strcmp(argv[i], "--max-size") == 0 && i + 1 < argc)
+        {
+            max_size = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--quadratic-limit") == 0 && i + 1 < argc)
+        {
+            quadratic_limit = std::atoi(argv[++i]);
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--csv] [--max-size N] [--quadratic-limit N]" << std::endl;
+            return 1;
+        }
+    }
+    if (csv)
+    {
+        std::cout << "type,size,order,op,ns_per_op,allocs_per_op,peak_rss_kb" << std::endl;
+    }
+    benchmarkType<int>(max_size, quadratic_limit);
+    benchmarkType<std::string>(max_size, quadratic_limit);
+    benchmarkType<ExamDetails>(max_size, quadratic_limit);
+    return 0;
+}
@@ -0,0 +1,388 @@
+#ifndef BINARY_SERIALIZATION_H
+#define BINARY_SERIALIZATION_H
+
+#include "sortedList.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SORTED_LIST_MMAP
+#endif
+
+namespace mtm
+{
+    /**
+     * @brief thrown when binary data is not a valid serialized list (bad header, cut or corrupt records).
+     */
+    class BinaryFormatError : public std::runtime_error
+    {
+    public:
+        explicit BinaryFormatError(const char *what) : std::runtime_error(what) {}
+    };
+
+    /*=======================================================================*/
+    /*========================= sinks and sources ===========================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief sink that collects the bytes in a buffer and writes them to the stream in big chunks
+     */
+    class StreamSink
+    {
+        static const std::size_t BUFFER_SIZE = 1 << 16;
+
+        std::ostream &os;
+        std::vector<char> buffer;
+
+    public:
+        explicit StreamSink(std::ostream &os) : os(os)
+        {
+            buffer.reserve(BUFFER_SIZE);
+        }
+        StreamSink(const StreamSink &sink) = delete;
+        StreamSink &operator=(const StreamSink &sink) = delete;
+        ~StreamSink()
+        {
+            flush();
+        }
+        void write(const void *bytes, std::size_t size)
+        {
+            if (buffer.size() + size > BUFFER_SIZE)
+            {
+                flush();
+            }
+            const char *begin = static_cast<const char *>(bytes);
+            buffer.insert(buffer.end(), begin, begin + size);
+        }
+        void flush()
+        {
+            os.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    };
+
+    /**
+     * @brief source that reads the bytes from a stream.
+     * the bytes left are known if the stream can seek, otherwise remaining() is as big as possible.
+     */
+    class StreamSource
+    {
+        std::istream &is;
+        std::size_t left;
+
+    public:
+        explicit StreamSource(std::istream &is) : is(is), left((std::size_t)-1)
+        {
+            std::streambuf *buffer = is.rdbuf();
+            std::streampos current = buffer->pubseekoff(0, std::ios::cur, std::ios::in);
+            if (current == std::streampos(-1))
+            {
+                return;
+            }
+            std::streampos end = buffer->pubseekoff(0, std::ios::end, std::ios::in);
+            buffer->pubseekpos(current, std::ios::in);
+            if (end != std::streampos(-1) && end >= current)
+            {
+                left = (std::size_t)(end - current);
+            }
+        }
+        void read(void *bytes, std::size_t size)
+        {
+            if (size > left || is.rdbuf()->sgetn(static_cast<char *>(bytes), size) != (std::streamsize)size)
+            {
+                throw BinaryFormatError("Unexpected end of data");
+            }
+            if (left != (std::size_t)-1)
+            {
+                left -= size;
+            }
+        }
+        std::size_t remaining() const
+        {
+            return left;
+        }
+    };
+
+    /**
+     * @brief source that reads the bytes from memory (like a mapped file)
+     */
+    class MemorySource
+    {
+        const char *current;
+        const char *end;
+
+    public:
+        MemorySource(const char *begin, const char *end) : current(begin), end(end) {}
+        void read(void *bytes, std::size_t size)
+        {
+            if ((std::size_t)(end - current) < size)
+            {
+                throw BinaryFormatError("Unexpected end of data");
+            }
+            std::memcpy(bytes, current, size);
+            current += size;
+        }
+        std::size_t remaining() const
+        {
+            return (std::size_t)(end - current);
+        }
+    };
+
+    /*=======================================================================*/
+    /*============================ BinaryCodec ==============================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief binary encoding of a T, specialize it for every type to serialize:
+     * template <class Sink> static void encode(const T &value, Sink &sink);
+     * template <class Source> static T decode(Source &source);
+     * a Source has read(bytes, size), which throws BinaryFormatError on a short read, and remaining(),
+     * the number of bytes left (or more, if it cannot tell).
+     * this default handles the arithmetic types of up to 64 bits, written little endian whatever the machine is.
+     */
+    template <class T>
+    struct BinaryCodec
+    {
+        static_assert(std::is_arithmetic<T>::value, "BinaryCodec is not specialized for this type");
+        static_assert(sizeof(T) <= sizeof(std::uint64_t), "BinaryCodec handles arithmetic types of up to 64 bits");
+
+        typedef typename std::conditional<sizeof(T) == 1, std::uint8_t,
+                                          typename std::conditional<sizeof(T) == 2, std::uint16_t,
+                                                                    typename std::conditional<sizeof(T) == 4, std::uint32_t,
+                                                                                              std::uint64_t>::type>::type>::type
+            Bits;
+
+        template <class Sink>
+        static void encode(const T &value, Sink &sink)
+        {
+            Bits bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            unsigned char bytes[sizeof(T)];
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+            {
+                bytes[i] = (unsigned char)(bits >> (8 * i));
+            }
+            sink.write(bytes, sizeof(T));
+        }
+
+        template <class Source>
+        static T decode(Source &source)
+        {
+            unsigned char bytes[sizeof(T)];
+            source.read(bytes, sizeof(T));
+            Bits bits = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i)
+            {
+                bits |= (Bits)bytes[i] << (8 * i);
+            }
+            T value;
+            std::memcpy(&value, &bits, sizeof(T));
+            return value;
+        }
+    };
+
+    /**
+     * @brief strings are written as their length (32 bit) and then their characters.
+     * the length is checked against the bytes left before anything is allocated, and when the source
+     * cannot tell, the characters are read in chunks, so a corrupt length cannot make a huge allocation.
+     */
+    template <>
+    struct BinaryCodec<std::string>
+    {
+        template <class Sink>
+        static void encode(const std::string &value, Sink &sink)
+        {
+            BinaryCodec<std::uint32_t>::encode((std::uint32_t)value.size(), sink);
+            sink.write(value.data(), value.size());
+        }
+
+        template <class Source>
+        static std::string decode(Source &source)
+        {
+            static const std::size_t CHUNK_SIZE = 1 << 16;
+            std::uint32_t size = BinaryCodec<std::uint32_t>::decode(source);
+            if (size > source.remaining())
+            {
+                throw BinaryFormatError("Unexpected end of data");
+            }
+            std::string value;
+            for (std::size_t done = 0; done < size;)
+            {
+                std::size_t chunk = std::min<std::size_t>(size - done, CHUNK_SIZE);
+                value.resize(done + chunk);
+                source.read(&value[done], chunk);
+                done += chunk;
+            }
+            return value;
+        }
+    };
+
+    /*=======================================================================*/
+    /*======================= SortedList read / write =======================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief a serialized list starts with the magic, the format version (16 bit), 16 reserved bits
+     * and the number of elements (64 bit), followed by the encoded elements in list order.
+     */
+    static const char SORTED_LIST_MAGIC[4] = {'M', 'T', 'S', 'L'};
+    static const std::uint16_t SORTED_LIST_VERSION = 1;
+
+    /**
+     * @brief writes the list to the stream: the header and then the elements in their order
+     * @param os
+     * @param list
+     */
+    template <class T, class Alloc>
+    void writeSortedList(std::ostream &os, const SortedList<T, Alloc> &list)
+    {
+        StreamSink sink(os);
+        sink.write(SORTED_LIST_MAGIC, sizeof(SORTED_LIST_MAGIC));
+        BinaryCodec<std::uint16_t>::encode(SORTED_LIST_VERSION, sink);
+        BinaryCodec<std::uint16_t>::encode(0, sink);
+        BinaryCodec<std::uint64_t>::encode((std::uint64_t)list.length(), sink);
+        for (const T &element : list)
+        {
+            BinaryCodec<T>::encode(element, sink);
+        }
+    }
+
+    /**
+     * @brief reads a list written by writeSortedList from the source.
+     * the elements come in order, so every insert is an O(1) append to the end of the list
+     * (a file that is not sorted still makes a sorted list, only slower).
+     * @param source
+     * @return SortedList<T, Alloc>
+     */
+    template <class T, class Alloc, class Source>
+    SortedList<T, Alloc> decodeSortedList(Source &source)
+    {
+        char magic[sizeof(SORTED_LIST_MAGIC)];
+        source.read(magic, sizeof(magic));
+        if (std::memcmp(magic, SORTED_LIST_MAGIC, sizeof(magic)) != 0)
+        {
+            throw BinaryFormatError("Not a serialized SortedList");
+        }
+        if (BinaryCodec<std::uint16_t>::decode(source) != SORTED_LIST_VERSION)
+        {
+            throw BinaryFormatError("Unsupported SortedList format version");
+        }
+        BinaryCodec<std::uint16_t>::decode(source);
+        std::uint64_t count = BinaryCodec<std::uint64_t>::decode(source);
+        SortedList<T, Alloc> list;
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            list.insert(BinaryCodec<T>::decode(source));
+        }
+        return list;
+    }
+
+    /**
+     * @brief reads a list written by writeSortedList from the stream
+     * @param is
+     * @return SortedList<T, Alloc>
+     */
+    template <class T, class Alloc = std::allocator<T>>
+    SortedList<T, Alloc> readSortedList(std::istream &is)
+    {
+        StreamSource source(is);
+        return decodeSortedList<T, Alloc>(source);
+    }
+
+    /**
+     * @brief writes the list to a file
+     * @param path
+     * @param list
+     */
+    template <class T, class Alloc>
+    void writeSortedListFile(const std::string &path, const SortedList<T, Alloc> &list)
+    {
+        std::ofstream file(path.c_str(), std::ios::binary);
+        if (!file)
+        {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        writeSortedList(file, list);
+        if (!file.flush())
+        {
+            throw std::runtime_error("Cannot write " + path);
+        }
+    }
+
+    /**
+     * @brief reads a list from a file written by writeSortedListFile.
+     * on POSIX systems the file is memory mapped and decoded straight from the mapping.
+     * @param path
+     * @return SortedList<T, Alloc>
+     */
+    template <class T, class Alloc = std::allocator<T>>
+    SortedList<T, Alloc> readSortedListFile(const std::string &path)
+    {
+#ifdef SORTED_LIST_MMAP
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0)
+        {
+            close(fd);
+            throw std::runtime_error("Cannot read " + path);
+        }
+        std::size_t size = (std::size_t)info.st_size;
+        void *mapping = size == 0 ? nullptr : mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            throw std::runtime_error("Cannot map " + path);
+        }
+        if (mapping != nullptr)
+        {
+            madvise(mapping, size, MADV_SEQUENTIAL);
+        }
+        const char *begin = static_cast<const char *>(mapping);
+        MemorySource source(begin, begin + size);
+        try
+        {
+            SortedList<T, Alloc> list = decodeSortedList<T, Alloc>(source);
+            if (mapping != nullptr)
+            {
+                munmap(mapping, size);
+            }
+            return list;
+        }
+        catch (...)
+        {
+            if (mapping != nullptr)
+            {
+                munmap(mapping, size);
+            }
+            throw;
+        }
+#else
+        std::ifstream file(path.c_str(), std::ios::binary);
+        if (!file)
+        {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        return readSortedList<T, Alloc>(file);
+#endif
+    }
+}
+
+#undef SORTED_LIST_MMAP
+
+#endif
@@ -0,0 +1,276 @@
+#ifndef CONCURRENT_SORTED_LIST_H
+#define CONCURRENT_SORTED_LIST_H
+
+#include "sortedList.h"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace mtm
+{
+
+    /*=======================================================================*/
+    /*===================== class ConcurrentSortedList ======================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief sorted list shared between writer threads and reader threads, RCU style:
+     * the list is published as an immutable SortedList, readers take a Snapshot of the current
+     * version with an atomic load of a shared_ptr and iterate it while writers publish new versions.
+     * readers never wait on the writer mutex, so a slow write doesnt hold them back. they are not
+     * lock free though: std::atomic_is_lock_free is false for shared_ptr in libstdc++ and libc++,
+     * where the atomic load and store take a short internal lock (per address, not per list).
+     * a writer copies the whole current version, changes the copy and publishes it, so every write
+     * costs O(length) time and memory, this is for lists read much more often than written.
+     * writers are serialized by a mutex; use update to make many changes with one copy.
+     * a version is freed when its last snapshot is gone, possibly on a reader thread,
+     * so Alloc must be safe to use from several threads (std::allocator is, NodePool is not).
+     */
+    template <class T, class Alloc = std::allocator<T>>
+    class ConcurrentSortedList
+    {
+        typedef SortedList<T, Alloc> List;
+
+        std::shared_ptr<const List> current;
+        std::mutex writer_lock;
+
+        /**
+         * @brief atomically replaces the current version
+         * @param list
+         */
+        void publish(std::shared_ptr<const List> list);
+
+    public:
+        class Snapshot;
+
+        /**
+         * @brief ConcurrentSortedList constructor, empty
+         */
+        ConcurrentSortedList();
+        /**
+         * @brief ConcurrentSortedList constructor with the first version
+         * @param list
+         */
+        explicit ConcurrentSortedList(List list);
+        ConcurrentSortedList(const ConcurrentSortedList<T, Alloc> &list) = delete;
+        ConcurrentSortedList<T, Alloc> &operator=(const ConcurrentSortedList<T, Alloc> &list) = delete;
+        ~ConcurrentSortedList() = default;
+
+        /**
+         * @brief get the current version of the list, never waits on the writer mutex
+         * @return Snapshot that stays the same while it is used
+         */
+        Snapshot snapshot() const;
+        /**
+         * @brief get the length of the current version
+         * @return int length
+         */
+        int length() const;
+
+        /**
+         * @brief insert a copy of the element and publish the new version
+         * @param element
+         * @return true if success , false if doesn't
+         */
+        bool insert(const T &element);
+        /**
+         * @brief insert the element and publish the new version
+         * @param element
+         * @return true if success , false if doesn't
+         */
+        bool insert(T &&element);
+        /**
+         * @brief remove the first element equal to the given one (neither is smaller than the other)
+         * @param element
+         * @return true if an element was removed, false if there was no such element
+         */
+        bool remove(const T &element);
+        /**
+         * @brief remove all the elements that func returns true for
+         * @param func
+         * @return int number of removed elements
+         */
+        template <typename predict>
+        int remove_if(predict func);
+        /**
+         * @brief make any changes to a copy of the current version and publish it as one new version
+         * @param func called with the copy (SortedList<T, Alloc>&)
+         */
+        template <typename modifier>
+        void update(modifier func);
+    };
+
+    /**
+     * @brief c`tor.
+     */
+    template <class T, class Alloc>
+    ConcurrentSortedList<T, Alloc>::ConcurrentSortedList() : current(std::make_shared<const List>()) {}
+
+    /**
+     * @brief c`tor with the first version.
+     * @param list list to publish, moved from.
+     */
+    template <class T, class Alloc>
+    ConcurrentSortedList<T, Alloc>::ConcurrentSortedList(List list)
+        : current(std::make_shared<const List>(std::move(list))) {}
+
+    template <class T, class Alloc>
+    void ConcurrentSortedList<T, Alloc>::publish(std::shared_ptr<const List> list)
+    {
+        std::atomic_store(&current, std::move(list));
+    }
+
+    /**
+     * @return the current version.
+     */
+    template <class T, class Alloc>
+    typename ConcurrentSortedList<T, Alloc>::Snapshot ConcurrentSortedList<T, Alloc>::snapshot() const
+    {
+        return Snapshot(std::atomic_load(&current));
+    }
+
+    /**
+     * @return length of the current version.
+     */
+    template <class T, class Alloc>
+    int ConcurrentSortedList<T, Alloc>::length() const
+    {
+        return std::atomic_load(&current)->length();
+    }
+
+    /**
+     * @brief update function, the writer lock is held from the copy to the publish so no write is lost.
+     * if func throws nothing is published.
+     * @param func function that changes the copy of the list.
+     */
+    template <class T, class Alloc>
+    template <typename modifier>
+    void ConcurrentSortedList<T, Alloc>::update(modifier func)
+    {
+        std::lock_guard<std::mutex> guard(writer_lock);
+        std::shared_ptr<List> copy = std::make_shared<List>(*std::atomic_load(&current));
+        func(*copy);
+        publish(std::move(copy));
+    }
+
+    /**
+     * @brief Insert funtion.
+     * @param element element to copy into the list.
+     * @return
+     */
+    template <class T, class Alloc>
+    bool ConcurrentSortedList<T, Alloc>::insert(const T &element)
+    {
+        update([&element](List &list)
+               { list.insert(element); });
+        return true;
+    }
+
+    /**
+     * @brief Insert funtion.
+     * @param element element to move into the list.
+     * @return
+     */
+    template <class T, class Alloc>
+    bool ConcurrentSortedList<T, Alloc>::insert(T &&element)
+    {
+        update([&element](List &list)
+               { list.insert(std::move(element)); });
+        return true;
+    }
+
+    /**
+     * @brief remove function, nothing is published if the element is not found.
+     * @param element element to remove.
+     * @return true if removed.
+     */
+    template <class T, class Alloc>
+    bool ConcurrentSortedList<T, Alloc>::remove(const T &element)
+    {
+        std::lock_guard<std::mutex> guard(writer_lock);
+        std::shared_ptr<List> copy = std::make_shared<List>(*std::atomic_load(&current));
+        for (typename List::const_iterator it = copy->begin(); it != copy->end() && !(element < *it); ++it)
+        {
+            if (!(*it < element))
+            {
+                copy->remove(it);
+                publish(std::move(copy));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief remove_if function.
+     * @param func boolean function, the elements it returns true for are removed.
+     * @return number of removed elements.
+     */
+    template <class T, class Alloc>
+    template <typename predict>
+    int ConcurrentSortedList<T, Alloc>::remove_if(predict func)
+    {
+        int removed = 0;
+        update([&func, &removed](List &list)
+               { removed = list.remove_if(func); });
+        return removed;
+    }
+
+    /*=======================================================================*/
+    /*=========================== class Snapshot ============================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief a version of a ConcurrentSortedList, it doesnt change and keeps its elements alive
+     * while it (or a copy of it) exists, its iterators are the SortedList iterators.
+     */
+    template <class T, class Alloc>
+    class ConcurrentSortedList<T, Alloc>::Snapshot
+    {
+        std::shared_ptr<const List> version;
+
+        /**
+         * @brief Snapshot constructor from the version it holds
+         * @param version
+         */
+        explicit Snapshot(std::shared_ptr<const List> version) : version(std::move(version)) {}
+
+    public:
+        Snapshot(const Snapshot &snapshot) = default;
+        Snapshot &operator=(const Snapshot &snapshot) = default;
+        ~Snapshot() = default;
+
+        /**
+         * @return the list of this version
+         */
+        const List &list() const
+        {
+            return *version;
+        }
+        /**
+         * @return int length of this version
+         */
+        int length() const
+        {
+            return version->length();
+        }
+        /**
+         * @return const_iterator to the first element of this version
+         */
+        typename List::const_iterator begin() const
+        {
+            return version->begin();
+        }
+        /**
+         * @return const_iterator to the end of this version
+         */
+        typename List::const_iterator end() const
+        {
+            return version->end();
+        }
+        friend class ConcurrentSortedList<T, Alloc>;
+    };
+}
+
+#endif
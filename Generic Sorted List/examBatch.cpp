@@ -0,0 +1,107 @@
+#include "examBatch.h"
+
+namespace mtm
+{
+    /**
+     * @brief reserve function.
+     * @param rows number of rows the batch will have.
+     */
+    void ExamBatch::reserve(int rows)
+    {
+        course_numbers.reserve(rows);
+        months.reserve(rows);
+        days.reserve(rows);
+        hours.reserve(rows);
+        lengths.reserve(rows);
+        zoom_links.reserve(rows);
+    }
+
+    /**
+     * @brief add function, the fields are checked later by validate or build.
+     */
+    void ExamBatch::add(int course_number, int month, int day, double hour, int length, const std::string &zoom_link)
+    {
+        course_numbers.push_back(course_number);
+        months.push_back(month);
+        days.push_back(day);
+        hours.push_back(hour);
+        lengths.push_back(length);
+        zoom_links.push_back(zoom_link);
+    }
+
+    /**
+     * @return number of rows.
+     */
+    int ExamBatch::size() const
+    {
+        return (int)course_numbers.size();
+    }
+
+    /**
+     * @brief clear function.
+     */
+    void ExamBatch::clear()
+    {
+        course_numbers.clear();
+        months.clear();
+        days.clear();
+        hours.clear();
+        lengths.clear();
+        zoom_links.clear();
+    }
+
+    /**
+     * @brief validate function, the checks of each row are combined with & and arithmetic instead of
+     * branches, so the loop runs the same for valid and invalid rows (and can be vectorized).
+     * an hour is valid if it is in [0, 23.5] and twice it is a whole number.
+     * @return the status of every row, the first failing check by the constructor order.
+     */
+    std::vector<ExamStatus> ExamBatch::validate() const
+    {
+        int rows = size();
+        std::vector<ExamStatus> statuses(rows);
+        const int *course_number = course_numbers.data();
+        const int *month = months.data();
+        const int *day = days.data();
+        const double *hour = hours.data();
+        const int *length = lengths.data();
+        ExamStatus *status = statuses.data();
+        for (int i = 0; i < rows; ++i)
+        {
+            int bad_args = course_number[i] <= 0;
+            int bad_date = (month[i] <= 0) | (month[i] > ExamDetails::MONTHS_PER_YEAR) | (day[i] <= 0) |
+                           (day[i] > ExamDetails::DAYS_PER_MONTH);
+            double slots = hour[i] * ExamDetails::SLOTS_PER_HOUR;
+            int hour_in_range = (slots >= 0) & (slots <= ExamDetails::SLOTS_PER_DAY - 1);
+            slots = hour_in_range ? slots : 0;
+            int bad_time = (1 - hour_in_range) | (slots != (double)(int)slots) | (length[i] <= 0);
+            int first_failure = bad_args * 1 + (1 - bad_args) * (bad_date * 2 + (1 - bad_date) * bad_time * 3);
+            status[i] = (ExamStatus)first_failure;
+        }
+        return statuses;
+    }
+
+    /**
+     * @brief build function, the valid rows are packed directly into exams,
+     * without checking them again and without exceptions.
+     * @param exams vector to add the valid exams to.
+     * @return the status of every row.
+     */
+    std::vector<ExamStatus> ExamBatch::build(std::vector<ExamDetails> &exams) const
+    {
+        std::vector<ExamStatus> statuses = validate();
+        int rows = size();
+        for (int i = 0; i < rows; ++i)
+        {
+            // only valid rows get here, so links of rejected rows are never interned
+            if (statuses[i] != ExamStatus::VALID)
+            {
+                continue;
+            }
+            std::uint16_t time_key = ExamDetails::packTimeKey(months[i], days[i], hours[i]);
+            exams.push_back(ExamDetails(course_numbers[i], lengths[i], time_key,
+                                        ExamDetails::internLink(zoom_links[i])));
+        }
+        return statuses;
+    }
+}
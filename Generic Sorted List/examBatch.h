@@ -0,0 +1,87 @@
+#ifndef EXAMBATCH_H_
+#define EXAMBATCH_H_
+
+#include "examDetails.h"
+
+#include <string>
+#include <vector>
+
+namespace mtm
+{
+    /**
+     * @brief result of checking the fields of one exam, by the order the ExamDetails constructor checks them.
+     * VALID - the exam can be created.
+     * INVALID_ARGS - the constructor would throw InvalidArgsException.
+     * INVALID_DATE - the constructor would throw InvalidDateException.
+     * INVALID_TIME - the constructor would throw InvalidTimeException.
+     */
+    enum class ExamStatus : unsigned char
+    {
+        VALID,
+        INVALID_ARGS,
+        INVALID_DATE,
+        INVALID_TIME
+    };
+
+    /**
+     * @brief raw exam fields of many exams (like the rows of a csv dump), kept column by column.
+     * the whole batch is checked in one pass without branches or exceptions,
+     * and only the valid rows are made into ExamDetails.
+     */
+    class ExamBatch
+    {
+        std::vector<int> course_numbers;
+        std::vector<int> months;
+        std::vector<int> days;
+        std::vector<double> hours;
+        std::vector<int> lengths;
+        std::vector<std::string> zoom_links;
+
+    public:
+        /**
+         * @brief empty batch
+         */
+        ExamBatch() = default;
+        ExamBatch(const ExamBatch &batch) = default;
+        ExamBatch &operator=(const ExamBatch &batch) = default;
+        ~ExamBatch() = default;
+
+        /**
+         * @brief makes room for rows without reallocating
+         * @param rows
+         */
+        void reserve(int rows);
+        /**
+         * @brief adds a row, nothing is checked here
+         * @param course_number
+         * @param month
+         * @param day
+         * @param hour
+         * @param length
+         * @param zoom_link
+         */
+        void add(int course_number, int month, int day, double hour, int length, const std::string &zoom_link = "");
+        /**
+         * @return number of rows
+         */
+        int size() const;
+        /**
+         * @brief removes all the rows
+         */
+        void clear();
+
+        /**
+         * @brief checks every row like the ExamDetails constructor would
+         * @return the status of every row
+         */
+        std::vector<ExamStatus> validate() const;
+        /**
+         * @brief checks every row and adds an ExamDetails for every valid row to exams, in row order
+         * @param exams
+         * @return the status of every row
+         */
+        std::vector<ExamStatus> build(std::vector<ExamDetails> &exams) const;
+    };
+}
+
+#endif
@@ -0,0 +1,221 @@
+#include "examCalendar.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace mtm
+{
+    /**
+     * @brief length in half hours, longer than a year is cut to a year
+     * (it reaches every later exam anyway and the end keys stay small).
+     */
+    static int lengthSlots(int length)
+    {
+        return length >= ExamDetails::SLOTS_PER_YEAR / ExamDetails::SLOTS_PER_HOUR
+                   ? ExamDetails::SLOTS_PER_YEAR
+                   : length * ExamDetails::SLOTS_PER_HOUR;
+    }
+
+    /**
+     * @brief default c`tor.
+     */
+    ExamCalendar::ExamCalendar() : max_slots(0), slot_counts(ExamDetails::SLOTS_PER_DAY + 1, 0) {}
+
+    void ExamCalendar::added(int index, int slots)
+    {
+        std::vector<int>::iterator later = std::lower_bound(long_exams.begin(), long_exams.end(), index);
+        for (std::vector<int>::iterator it = later; it != long_exams.end(); ++it)
+        {
+            ++*it;
+        }
+        if (slots > ExamDetails::SLOTS_PER_DAY)
+        {
+            long_exams.insert(later, index);
+            return;
+        }
+        slot_counts[slots]++;
+        max_slots = std::max(max_slots, slots);
+    }
+
+    /**
+     * @brief removed function, max_slots goes down to the next length that has exams (at most a day of
+     * half hours to check).
+     */
+    void ExamCalendar::removed(int index, int slots)
+    {
+        std::vector<int>::iterator later = std::lower_bound(long_exams.begin(), long_exams.end(), index);
+        if (slots > ExamDetails::SLOTS_PER_DAY)
+        {
+            later = long_exams.erase(later);
+        }
+        else
+        {
+            slot_counts[slots]--;
+            while (max_slots > 0 && slot_counts[max_slots] == 0)
+            {
+                max_slots--;
+            }
+        }
+        for (std::vector<int>::iterator it = later; it != long_exams.end(); ++it)
+        {
+            --*it;
+        }
+    }
+
+    /**
+     * @brief sorts the exams by time (stable, so equal times keep their order) and appends
+     * them to the columns.
+     * @param exams exams to put in the calendar, which must be empty.
+     */
+    void ExamCalendar::build(std::vector<ExamDetails> &exams)
+    {
+        std::stable_sort(exams.begin(), exams.end());
+        time_keys.reserve(exams.size());
+        end_keys.reserve(exams.size());
+        course_numbers.reserve(exams.size());
+        lengths.reserve(exams.size());
+        zoom_links.reserve(exams.size());
+        for (const ExamDetails &exam : exams)
+        {
+            int slots = lengthSlots(exam.length);
+            time_keys.push_back(exam.time_key);
+            end_keys.push_back(exam.time_key + slots);
+            course_numbers.push_back(exam.course_number);
+            lengths.push_back(exam.length);
+            zoom_links.push_back(exam.zoom_link);
+            added(size() - 1, slots);
+        }
+    }
+
+    /**
+     * @brief insert function, O(size) for moving the later exams in every column.
+     * @param exam exam to add.
+     */
+    void ExamCalendar::insert(const ExamDetails &exam)
+    {
+        int index = std::upper_bound(time_keys.begin(), time_keys.end(), exam.time_key) - time_keys.begin();
+        int slots = lengthSlots(exam.length);
+        time_keys.insert(time_keys.begin() + index, exam.time_key);
+        end_keys.insert(end_keys.begin() + index, exam.time_key + slots);
+        course_numbers.insert(course_numbers.begin() + index, exam.course_number);
+        lengths.insert(lengths.begin() + index, exam.length);
+        zoom_links.insert(zoom_links.begin() + index, exam.zoom_link);
+        added(index, slots);
+    }
+
+    /**
+     * @brief erase function.
+     * @param index index of the exam to remove.
+     * @exception out_of_range if there is no exam at the index.
+     */
+    void ExamCalendar::erase(int index)
+    {
+        if (index < 0 || index >= size())
+        {
+            throw std::out_of_range("Out of range");
+        }
+        removed(index, end_keys[index] - time_keys[index]);
+        time_keys.erase(time_keys.begin() + index);
+        end_keys.erase(end_keys.begin() + index);
+        course_numbers.erase(course_numbers.begin() + index);
+        lengths.erase(lengths.begin() + index);
+        zoom_links.erase(zoom_links.begin() + index);
+    }
+
+    /**
+     * @return number of exams.
+     */
+    int ExamCalendar::size() const
+    {
+        return (int)time_keys.size();
+    }
+
+    /**
+     * @brief gathers the exam from the columns.
+     * @param index index of the exam, by time order.
+     * @return the exam.
+     * @exception out_of_range if there is no exam at the index.
+     */
+    ExamDetails ExamCalendar::operator[](int index) const
+    {
+        if (index < 0 || index >= size())
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return ExamDetails(course_numbers[index], lengths[index], time_keys[index], zoom_links[index]);
+    }
+
+    int ExamCalendar::lowerBound(int key) const
+    {
+        return std::lower_bound(time_keys.begin(), time_keys.end(), key) - time_keys.begin();
+    }
+
+    /**
+     * @brief only exams that start less than max_slots before the window can reach it, so the scan
+     * starts there (binary search) and stops at the first exam that starts after the window.
+     * the long exams before the scan are checked one by one, they come first in time order.
+     * the scan of the end keys has no branches, every exam is written to the result and counted
+     * only if it ends inside the window.
+     * @param first_key first half hour of the window.
+     * @param end_key half hour after the window.
+     * @return indexes of the exams.
+     */
+    std::vector<int> ExamCalendar::overlapping(int first_key, int end_key) const
+    {
+        int first = lowerBound(first_key - max_slots + 1);
+        int last = lowerBound(end_key);
+        std::vector<int> found;
+        for (std::vector<int>::const_iterator it = long_exams.begin(); it != long_exams.end() && *it < first; ++it)
+        {
+            if (end_keys[*it] > first_key)
+            {
+                found.push_back(*it);
+            }
+        }
+        int count = (int)found.size();
+        found.resize(count + std::max(last - first, 0));
+        const int *ends = end_keys.data();
+        for (int i = first; i < last; ++i)
+        {
+            found[count] = i;
+            count += ends[i] > first_key;
+        }
+        found.resize(count);
+        return found;
+    }
+
+    /**
+     * @brief overlapping function.
+     * @exception InvalidDateException if the month or day are not a valid exam date.
+     * @exception InvalidTimeException if the hour or length are not valid for an exam.
+     */
+    std::vector<int> ExamCalendar::overlapping(int month, int day, double hour, int length) const
+    {
+        int first_key = ExamDetails::makeTimeKey(month, day, hour);
+        if (length <= 0)
+        {
+            throw ExamDetails::InvalidTimeException();
+        }
+        return overlapping(first_key, first_key + lengthSlots(length));
+    }
+
+    std::vector<int> ExamCalendar::overlapping(const ExamDetails &exam) const
+    {
+        return overlapping(exam.time_key, exam.time_key + lengthSlots(exam.length));
+    }
+
+    /**
+     * @brief startingOn function, the exams of a day are consecutive in the calendar.
+     * @exception InvalidDateException if the month or day are not a valid exam date.
+     */
+    std::vector<int> ExamCalendar::startingOn(int month, int day) const
+    {
+        int first_key = ExamDetails::makeTimeKey(month, day, 0);
+        std::vector<int> found;
+        for (int i = lowerBound(first_key), last = lowerBound(first_key + ExamDetails::SLOTS_PER_DAY); i < last; ++i)
+        {
+            found.push_back(i);
+        }
+        return found;
+    }
+}
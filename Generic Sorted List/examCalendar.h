@@ -0,0 +1,130 @@
+#ifndef EXAMCALENDAR_H_
+#define EXAMCALENDAR_H_
+
+#include "examDetails.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mtm
+{
+    /**
+     * @brief calendar of exams kept column by column (struct of arrays), sorted by the exam time key.
+     * exams at the same time keep the order they were inserted in.
+     * time windows are answered with a binary search on the time keys and a scan of the end times
+     * of the exams that start close enough before the window to reach it.
+     * exams longer than a day are kept aside in long_exams, so a single long exam doesnt widen the scan
+     * of every query.
+     */
+    class ExamCalendar
+    {
+        std::vector<std::uint16_t> time_keys;
+        std::vector<int> end_keys;
+        std::vector<int> course_numbers;
+        std::vector<int> lengths;
+        std::vector<const std::string *> zoom_links;
+        /**
+         * @brief the longest exam of at most a day in the calendar, in half hours
+         */
+        int max_slots;
+        /**
+         * @brief number of exams of at most a day of every length in half hours, to update max_slots on erase
+         */
+        std::vector<int> slot_counts;
+        /**
+         * @brief indexes of the exams longer than a day, sorted
+         */
+        std::vector<int> long_exams;
+
+        /**
+         * @brief indexes of the exams that overlap the half hours [first_key, end_key)
+         */
+        std::vector<int> overlapping(int first_key, int end_key) const;
+        /**
+         * @return the index of the first exam that starts at the key or after it
+         */
+        int lowerBound(int key) const;
+        /**
+         * @brief counts the exam that was put at the index, moving the later long exams by one
+         */
+        void added(int index, int slots);
+        /**
+         * @brief stops counting the exam that was at the index, moving the later long exams back by one
+         */
+        void removed(int index, int slots);
+        /**
+         * @brief fills the empty calendar with the exams, sorted once
+         */
+        void build(std::vector<ExamDetails> &exams);
+
+    public:
+        /**
+         * @brief empty calendar
+         */
+        ExamCalendar();
+        /**
+         * @brief calendar of the exams of a range (in any order)
+         * @param first
+         * @param last
+         */
+        template <class InputIt>
+        ExamCalendar(InputIt first, InputIt last);
+        ExamCalendar(const ExamCalendar &calendar) = default;
+        ExamCalendar &operator=(const ExamCalendar &calendar) = default;
+        ~ExamCalendar() = default;
+
+        /**
+         * @brief adds the exam after the exams with the same time
+         * @param exam
+         */
+        void insert(const ExamDetails &exam);
+        /**
+         * @brief removes the exam at the index
+         * @param index
+         */
+        void erase(int index);
+        /**
+         * @return number of exams in the calendar
+         */
+        int size() const;
+        /**
+         * @brief the exam at the index, by time order
+         * @param index
+         * @return ExamDetails
+         */
+        ExamDetails operator[](int index) const;
+
+        /**
+         * @brief finds the exams that take place in any part of the window
+         * @param month
+         * @param day
+         * @param hour start of the window
+         * @param length length of the window in hours
+         * @return indexes of the exams, in time order
+         */
+        std::vector<int> overlapping(int month, int day, double hour, int length) const;
+        /**
+         * @brief finds the exams that take place in any part of the exam time
+         * @param exam
+         * @return indexes of the exams, in time order
+         */
+        std::vector<int> overlapping(const ExamDetails &exam) const;
+        /**
+         * @brief finds the exams that start on the day
+         * @param month
+         * @param day
+         * @return indexes of the exams, in time order
+         */
+        std::vector<int> startingOn(int month, int day) const;
+    };
+
+    template <class InputIt>
+    ExamCalendar::ExamCalendar(InputIt first, InputIt last) : ExamCalendar()
+    {
+        std::vector<ExamDetails> exams(first, last);
+        build(exams);
+    }
+}
+
+#endif
@@ -1,12 +1,32 @@
 #include <iostream>
+#include <type_traits>
 #include "examDetails.h"
-#define MAX_MONTH 12
-#define MAX_DAY 30
+#include "stringPool.h"
 #define HALF 0.5
 #define MAX_HOUR 23.5
 
 namespace mtm
 {
+    static_assert(std::is_trivially_copyable<ExamDetails>::value, "ExamDetails copies must stay trivial");
+
+    const int ExamDetails::MONTHS_PER_YEAR;
+    const int ExamDetails::DAYS_PER_MONTH;
+    const int ExamDetails::SLOTS_PER_HOUR;
+    const int ExamDetails::SLOTS_PER_DAY;
+    const int ExamDetails::SLOTS_PER_YEAR;
+
+    /**
+     * @brief interns the link in the pool of all the exams links.
+     * @param link link to intern.
+     * @return pointer to the shared string, valid for the whole run of the program
+     * (the pool is never destroyed, so exams in static variables keep valid links at exit).
+     */
+    const std::string *ExamDetails::internLink(const std::string &link)
+    {
+        static StringPool *links = new StringPool();
+        return &links->intern(link);
+    }
+
     /**
      * @brief parameters c`tor
      * @param course_number_new Course number, must be positive.
@@ -21,53 +41,109 @@ namespace mtm
      * @exception InvalidTimeException if the hour or length dont match the demands.
      */
     ExamDetails::ExamDetails(int course_number_new, int month_new, int day_new, double hour_new, 
-                            int length_new, std::string zoom_link_new) : zoom_link(zoom_link_new)
+                            int length_new, const std::string &zoom_link_new)
     {
         if (course_number_new <= 0)
         {
             throw InvalidArgsException();
         }
-        if (month_new <= 0 || month_new > MAX_MONTH || day_new <= 0 || day_new > MAX_DAY)
+        time_key = makeTimeKey(month_new, day_new, hour_new);
+        if (length_new <= 0)
+        {
+            throw InvalidTimeException();
+        }
+        course_number = course_number_new;
+        length = length_new;
+        // interned only after all the checks, so rejected exams dont leave their links in the pool
+        zoom_link = internLink(zoom_link_new);
+    }
+
+    /**
+     * @brief packed fields c`tor, nothing is checked.
+     * @param course_number_new Course number.
+     * @param length_new The length of the exam.
+     * @param time_key_new The packed month, day and hour of the exam.
+     * @param zoom_link_new Interned zoom link.
+     */
+    ExamDetails::ExamDetails(int course_number_new, int length_new, std::uint16_t time_key_new,
+                             const std::string *zoom_link_new)
+        : zoom_link(zoom_link_new), course_number(course_number_new), length(length_new), time_key(time_key_new) {}
+
+    /**
+     * @brief checks the date and hour of an exam and packs them.
+     * @param month The month of the exam. must be between 1 and 12.
+     * @param day The day of the exam, must be between 1 and 30.
+     * @param hour The hour of the exam, must be end with .0 or .5 (like 4.0 or 2.5)
+     * @return the time key of the exam.
+     * @exception InvalidDateException if the month or day dont match the demands.
+     * @exception InvalidTimeException if the hour doesnt match the demands.
+     */
+    std::uint16_t ExamDetails::makeTimeKey(int month, int day, double hour)
+    {
+        if (month <= 0 || month > MONTHS_PER_YEAR || day <= 0 || day > DAYS_PER_MONTH)
         {
             throw InvalidDateException();
         }
-        if ((hour_new < 0 || hour_new > MAX_HOUR) ||
-            ((hour_new - (int)hour_new != 0) && (hour_new - (int)hour_new != HALF)) ||
-            (length_new <= 0))
+        if ((hour < 0 || hour > MAX_HOUR) ||
+            ((hour - (int)hour != 0) && (hour - (int)hour != HALF)))
         {
             throw InvalidTimeException();
         }
-        course_number = course_number_new;
-        month = month_new;
-        day = day_new;
-        hour = hour_new;
-        length = length_new;
+        return packTimeKey(month, day, hour);
+    }
+
+    /**
+     * @brief packs the date and hour of an exam, nothing is checked.
+     * @param month The month of the exam, between 1 and 12.
+     * @param day The day of the exam, between 1 and 30.
+     * @param hour The hour of the exam, a whole or half hour.
+     * @return the time key of the exam.
+     */
+    std::uint16_t ExamDetails::packTimeKey(int month, int day, double hour)
+    {
+        return ((month - 1) * DAYS_PER_MONTH + (day - 1)) * SLOTS_PER_DAY + (int)(hour * SLOTS_PER_HOUR);
+    }
+
+    /**
+     * @return the month of the exam, unpacked from the time key.
+     */
+    int ExamDetails::getMonth() const
+    {
+        return time_key / (DAYS_PER_MONTH * SLOTS_PER_DAY) + 1;
+    }
+
+    /**
+     * @return the day of the exam, unpacked from the time key.
+     */
+    int ExamDetails::getDay() const
+    {
+        return time_key / SLOTS_PER_DAY % DAYS_PER_MONTH + 1;
     }
 
     /**
-     * @brief copy c`tor.
-     * @param exam The exam we copy.
+     * @return the hour of the exam, unpacked from the time key.
      */
-    ExamDetails::ExamDetails(const ExamDetails &exam)
-        : course_number(exam.course_number), month(exam.month), day(exam.day),
-          hour(exam.hour), length(exam.length), zoom_link(exam.zoom_link) {}
+    double ExamDetails::getHour() const
+    {
+        return (time_key % SLOTS_PER_DAY) * HALF;
+    }
 
     /**
      * @brief Getter for the zoom link
      * @return zoom link as string.
      */
-    std::string ExamDetails::getLink() const
+    const std::string &ExamDetails::getLink() const
     {
-        return zoom_link;
+        return *zoom_link;
     }
 
     /**
      * @brief Setter for the zoom link
      * @param new_link new link to set
      */
-    void ExamDetails::setLink(const std::string new_link)
+    void ExamDetails::setLink(const std::string &new_link)
     {
-        zoom_link = new_link;
+        zoom_link = internLink(new_link);
     }
 
     /**
@@ -77,17 +153,17 @@ namespace mtm
      */
     int ExamDetails::operator-(const ExamDetails &exam) const
     {
-        return (month - exam.month) * 30 + (day - exam.day);
+        return time_key / SLOTS_PER_DAY - exam.time_key / SLOTS_PER_DAY;
     }
 
     /**
      * @brief operator < override.
      * @param exam exam to compare
-     * @return true if the exam is happening before the compared one.
+     * @return true if the exam is happening before the compared one (by date, then by hour).
      */
     bool ExamDetails::operator<(const ExamDetails &exam) const
     {
-        return (*this - exam == 0) ? (*this - exam) < 0 : (hour - exam.hour) < 0;
+        return time_key < exam.time_key;
     }
 
     /**
@@ -103,12 +179,13 @@ namespace mtm
      */
     std::ostream &operator<<(std::ostream &os, const ExamDetails &exam)
     {
-        std::string hour = ((exam.hour - (int)exam.hour) == 0) ? ":00" : ":30";
+        double exam_hour = exam.getHour();
+        std::string hour = ((exam_hour - (int)exam_hour) == 0) ? ":00" : ":30";
         os << "Course Number: " << exam.course_number << std::endl;
-        os << "Time: " << exam.day << "." << exam.month << " at ";
-        os << (int)exam.hour << hour << std::endl;
+        os << "Time: " << exam.getDay() << "." << exam.getMonth() << " at ";
+        os << (int)exam_hour << hour << std::endl;
         os << "Duration: " << exam.length << ":00" << std::endl;
-        os << "Zoom Link: " << exam.zoom_link << std::endl;
+        os << "Zoom Link: " << *exam.zoom_link << std::endl;
         return os;
     }
 
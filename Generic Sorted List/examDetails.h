@@ -1,20 +1,79 @@
 #ifndef EXAMDETAILS_H_
 #define EXAMDETAILS_H_
 
+#include <cstdint>
 #include <string>
 
 namespace mtm
 {
+    template <class T>
+    struct BinaryCodec;
+
     class ExamDetails
     {
-        int course_number; 
-        int month;
-        int day;
-        double hour;
+        const std::string *zoom_link;
+        int course_number;
         int length;
-        std::string zoom_link;
+        /**
+         * @brief the month, day and half hour of the exam packed in one number that is ordered like them:
+         * ((month - 1) * DAYS_PER_MONTH + (day - 1)) * SLOTS_PER_DAY + hour * SLOTS_PER_HOUR
+         */
+        std::uint16_t time_key;
+
+        /**
+         * @brief unchecked constructor from the packed fields, for the exam containers
+         * @param course_number
+         * @param length
+         * @param time_key
+         * @param zoom_link interned link
+         */
+        ExamDetails(int course_number, int length, std::uint16_t time_key, const std::string *zoom_link);
+        /**
+         * @brief checks the date and the hour and packs them into a time key
+         * @param month
+         * @param day
+         * @param hour
+         * @return std::uint16_t the time key
+         */
+        static std::uint16_t makeTimeKey(int month, int day, double hour);
+        /**
+         * @brief packs a date and an hour that were already checked into a time key
+         * @param month
+         * @param day
+         * @param hour
+         * @return std::uint16_t the time key
+         */
+        static std::uint16_t packTimeKey(int month, int day, double hour);
+        /**
+         * @brief interns the link in the pool of all the exams links.
+         * the pool is global and lives until the process exits, every distinct link ever given to an exam
+         * (through the c`tor, setLink or reading a binary file) stays in memory, even after its exams are gone.
+         * @param link
+         * @return const std::string* the shared link
+         */
+        static const std::string *internLink(const std::string &link);
+
+        int getMonth() const;
+        int getDay() const;
+        double getHour() const;
+
+        friend class ExamCalendar;
+        friend class ExamBatch;
+        friend struct BinaryCodec<ExamDetails>;
 
     public:
+        /**
+         * @brief the calendar of the exams: 12 months of 30 days, split into half hour slots
+         */
+        static const int MONTHS_PER_YEAR = 12;
+        static const int DAYS_PER_MONTH = 30;
+        static const int SLOTS_PER_HOUR = 2;
+        static const int SLOTS_PER_DAY = 24 * SLOTS_PER_HOUR;
+        /**
+         * @brief every time key is smaller than this
+         */
+        static const int SLOTS_PER_YEAR = MONTHS_PER_YEAR * DAYS_PER_MONTH * SLOTS_PER_DAY;
+
         class InvalidDateException
         {
         };
@@ -34,12 +93,17 @@ namespace mtm
          * @param zoom_link
          */
         ExamDetails(int course_number,
-         int month, int day, double hour, int length, std::string zoom_link = "");
+         int month, int day, double hour, int length, const std::string &zoom_link = "");
+        /**
+         * @brief Copy constructor for ExamDetails, the zoom link is shared and not copied
+         * @param exam
+         */
+        ExamDetails(const ExamDetails &exam) = default;
         /**
-         * @brief Copy constructor for ExamDetails
+         * @brief Move constructor for ExamDetails
          * @param exam
          */
-        ExamDetails(const ExamDetails &exam);
+        ExamDetails(ExamDetails &&exam) = default;
         /**
          * @brief default destructor for ExamDetails
          * @param 
@@ -51,17 +115,23 @@ namespace mtm
          * @return ExamDetails&
          */
         ExamDetails &operator=(const ExamDetails &exam) = default;
+        /**
+         * @brief move operator= for ExamDetails
+         * @param exam
+         * @return ExamDetails&
+         */
+        ExamDetails &operator=(ExamDetails &&exam) = default;
         /**
          * @brief get Test link
-         * @return string link
+         * @return refrence to the interned link, shared by all the exams with this link
          */
-        std::string getLink() const;
+        const std::string &getLink() const;
         /**
          * @brief set Test link
          * @param new_link
          * @return (void)
          */
-        void setLink(const std::string new_link);
+        void setLink(const std::string &new_link);
         /**
          * @brief operator- for ExamDetails
          * @param const ExamDetails&
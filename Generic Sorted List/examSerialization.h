@@ -0,0 +1,44 @@
+#ifndef EXAM_SERIALIZATION_H_
+#define EXAM_SERIALIZATION_H_
+
+#include "binarySerialization.h"
+#include "examDetails.h"
+
+#include <cstdint>
+#include <string>
+
+namespace mtm
+{
+    /**
+     * @brief an exam is written as its course number and length (32 bit each), its time key (16 bit)
+     * and its zoom link. decoded exams are checked and their links interned again.
+     */
+    template <>
+    struct BinaryCodec<ExamDetails>
+    {
+        template <class Sink>
+        static void encode(const ExamDetails &exam, Sink &sink)
+        {
+            BinaryCodec<std::int32_t>::encode(exam.course_number, sink);
+            BinaryCodec<std::int32_t>::encode(exam.length, sink);
+            BinaryCodec<std::uint16_t>::encode(exam.time_key, sink);
+            BinaryCodec<std::string>::encode(*exam.zoom_link, sink);
+        }
+
+        template <class Source>
+        static ExamDetails decode(Source &source)
+        {
+            std::int32_t course_number = BinaryCodec<std::int32_t>::decode(source);
+            std::int32_t length = BinaryCodec<std::int32_t>::decode(source);
+            std::uint16_t time_key = BinaryCodec<std::uint16_t>::decode(source);
+            std::string zoom_link = BinaryCodec<std::string>::decode(source);
+            if (course_number <= 0 || length <= 0 || time_key >= ExamDetails::SLOTS_PER_YEAR)
+            {
+                throw BinaryFormatError("Corrupt ExamDetails record");
+            }
+            return ExamDetails(course_number, length, time_key, ExamDetails::internLink(zoom_link));
+        }
+    };
+}
+
+#endif
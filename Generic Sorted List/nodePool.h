@@ -0,0 +1,227 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace mtm
+{
+
+    /*=======================================================================*/
+    /*========================== class NodeArena ============================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief memory of same-size slots, carved out of big blocks.
+     * freed slots go to a free list and are reused before carving new ones,
+     * the blocks themselves are released together only when the arena is destroyed.
+     * not thread safe, an arena must be used by one thread at a time.
+     */
+    class NodeArena
+    {
+        static const std::size_t FIRST_BLOCK_SLOTS = 64;
+        static const std::size_t MAX_BLOCK_SLOTS = 4096;
+
+        /**
+         * @brief a free slot keeps the next free slot in its own memory
+         */
+        struct FreeSlot
+        {
+            FreeSlot *next;
+        };
+
+        std::size_t slot_size;
+        std::size_t block_slots;
+        char *current;
+        char *current_end;
+        FreeSlot *free_list;
+        std::vector<void *> blocks;
+
+        /**
+         * @brief allocates a new block, each block is double the size of the previous one (up to MAX_BLOCK_SLOTS)
+         */
+        void grow()
+        {
+            char *block = static_cast<char *>(::operator new(slot_size * block_slots));
+            blocks.push_back(block);
+            current = block;
+            current_end = block + slot_size * block_slots;
+            if (block_slots < MAX_BLOCK_SLOTS)
+            {
+                block_slots *= 2;
+            }
+        }
+
+    public:
+        /**
+         * @brief arena of slots big enough for objects of the given size
+         * @param object_size
+         */
+        explicit NodeArena(std::size_t object_size)
+            : slot_size(object_size < sizeof(FreeSlot) ? sizeof(FreeSlot) : object_size),
+              block_slots(FIRST_BLOCK_SLOTS), current(nullptr), current_end(nullptr), free_list(nullptr)
+        {
+            const std::size_t align = alignof(std::max_align_t);
+            slot_size = (slot_size + align - 1) / align * align;
+        }
+        NodeArena(const NodeArena &arena) = delete;
+        NodeArena &operator=(const NodeArena &arena) = delete;
+        /**
+         * @brief releases all the blocks at once, every slot must have been given back (or not used anymore)
+         */
+        ~NodeArena()
+        {
+            for (void *block : blocks)
+            {
+                ::operator delete(block);
+            }
+        }
+
+        /**
+         * @return size in bytes of every slot
+         */
+        std::size_t slotSize() const
+        {
+            return slot_size;
+        }
+        /**
+         * @return number of blocks allocated so far
+         */
+        std::size_t blockCount() const
+        {
+            return blocks.size();
+        }
+        /**
+         * @brief gives a slot, a recycled one if there is, else the next one in the current block
+         * @return void* memory of slotSize() bytes
+         */
+        void *allocate()
+        {
+            if (free_list != nullptr)
+            {
+                FreeSlot *slot = free_list;
+                free_list = slot->next;
+                return slot;
+            }
+            if (current == current_end)
+            {
+                grow();
+            }
+            void *slot = current;
+            current += slot_size;
+            return slot;
+        }
+        /**
+         * @brief puts the slot in the free list for the next allocate
+         * @param slot memory returned by allocate of this arena
+         */
+        void deallocate(void *slot)
+        {
+            FreeSlot *freed = static_cast<FreeSlot *>(slot);
+            freed->next = free_list;
+            free_list = freed;
+        }
+    };
+
+    /*=======================================================================*/
+    /*=========================== class NodePool ============================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief allocator that takes single objects from a shared NodeArena, for node based containers:
+     * SortedList<T, NodePool<T>> list;
+     * copies of a pool (and its rebinds) share the same arena, so lists built with the same pool
+     * recycle each other's nodes, and the arena is released in bulk with the last pool using it.
+     * the arena slot size is set by the first allocation, allocations that dont fit a slot
+     * (arrays, bigger or over-aligned types) fall back to ::operator new.
+     * like NodeArena it is not thread safe: all the lists sharing a pool must be changed from one
+     * thread at a time (parallelFilter/parallelApply are fine, they make all the nodes on the calling thread).
+     */
+    template <class T>
+    class NodePool
+    {
+        /**
+         * @brief shared slot of the arena, so pools copied before the first allocation still share it
+         */
+        std::shared_ptr<std::unique_ptr<NodeArena>> arena;
+
+        template <class U>
+        friend class NodePool;
+
+        /**
+         * @return true if n objects of T are taken from the arena slots
+         */
+        bool fits(std::size_t n) const
+        {
+            return n == 1 && alignof(T) <= alignof(std::max_align_t) &&
+                   (*arena == nullptr || sizeof(T) <= (*arena)->slotSize());
+        }
+
+    public:
+        typedef T value_type;
+
+        /**
+         * @brief new pool with its own (still empty) arena
+         */
+        NodePool() : arena(std::make_shared<std::unique_ptr<NodeArena>>()) {}
+        NodePool(const NodePool<T> &pool) = default;
+        /**
+         * @brief rebind copy, shares the arena of pool
+         * @param pool
+         */
+        template <class U>
+        NodePool(const NodePool<U> &pool) : arena(pool.arena) {}
+        NodePool<T> &operator=(const NodePool<T> &pool) = default;
+        ~NodePool() = default;
+
+        /**
+         * @brief allocates memory for n objects of T
+         * @param n
+         * @return T* uninitialized memory
+         */
+        T *allocate(std::size_t n)
+        {
+            if (!fits(n))
+            {
+                return static_cast<T *>(::operator new(n * sizeof(T)));
+            }
+            if (*arena == nullptr)
+            {
+                arena->reset(new NodeArena(sizeof(T)));
+            }
+            return static_cast<T *>((*arena)->allocate());
+        }
+        /**
+         * @brief gives back memory from allocate, arena slots are recycled and not freed
+         * @param p
+         * @param n the n given to allocate
+         */
+        void deallocate(T *p, std::size_t n)
+        {
+            if (!fits(n))
+            {
+                ::operator delete(p);
+                return;
+            }
+            (*arena)->deallocate(p);
+        }
+
+        /**
+         * @return true if the pools share an arena (memory of one can be given back to the other)
+         */
+        template <class U>
+        bool operator==(const NodePool<U> &pool) const
+        {
+            return arena == pool.arena;
+        }
+        template <class U>
+        bool operator!=(const NodePool<U> &pool) const
+        {
+            return arena != pool.arena;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,169 @@
+#ifndef PARALLEL_SORTED_LIST_H
+#define PARALLEL_SORTED_LIST_H
+
+#include "sortedList.h"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mtm
+{
+
+    /**
+     * @brief number of chunks to split a list of the given length to
+     * @param length
+     * @param threads number of threads asked for, 0 for the number of cores
+     * @return int at most one chunk per element
+     */
+    inline int chunkCount(int length, unsigned int threads)
+    {
+        if (threads == 0)
+        {
+            threads = std::thread::hardware_concurrency();
+        }
+        int chunks = threads == 0 ? 1 : (int)threads;
+        return chunks < length ? chunks : length;
+    }
+
+    /**
+     * @brief splits the list into consecutive chunks and calls work(chunk, index, first, count)
+     * for every chunk on its own thread (the last chunk on the calling thread).
+     * if a thread cannot be started, the chunks left are run on the calling thread.
+     * an exception thrown by work is rethrown after all the threads are joined.
+     * work only reads the list, it must not make or delete nodes: the nodes of the results are made
+     * on the calling thread, so lists with an allocator that is not thread safe (NodePool) can be used.
+     * @param list
+     * @param chunks number of chunks, from chunkCount
+     * @param work called with the chunk number, the index and iterator of its first element and its length
+     */
+    template <class T, class Alloc, typename chunkWork>
+    void forEachChunk(const SortedList<T, Alloc> &list, int chunks, chunkWork work)
+    {
+        if (chunks == 0)
+        {
+            return;
+        }
+        int length = list.length();
+        std::vector<typename SortedList<T, Alloc>::const_iterator> starts;
+        std::vector<int> indexes;
+        std::vector<int> counts;
+        typename SortedList<T, Alloc>::const_iterator it = list.begin();
+        for (int chunk = 0; chunk < chunks; ++chunk)
+        {
+            int count = length / chunks + (chunk < length % chunks ? 1 : 0);
+            starts.push_back(it);
+            indexes.push_back(chunk == 0 ? 0 : indexes.back() + counts.back());
+            counts.push_back(count);
+            for (int i = 0; i < count; ++i)
+            {
+                ++it;
+            }
+        }
+        std::vector<std::exception_ptr> errors(chunks);
+        auto runChunk = [&](int chunk)
+        {
+            try
+            {
+                work(chunk, indexes[chunk], starts[chunk], counts[chunk]);
+            }
+            catch (...)
+            {
+                errors[chunk] = std::current_exception();
+            }
+        };
+        std::vector<std::thread> workers;
+        workers.reserve(chunks - 1);
+        try
+        {
+            for (int chunk = 0; chunk < chunks - 1; ++chunk)
+            {
+                workers.emplace_back(runChunk, chunk);
+            }
+        }
+        catch (...)
+        {
+            // no more threads (std::system_error), the threads that started are joined below
+        }
+        for (int chunk = (int)workers.size(); chunk < chunks; ++chunk)
+        {
+            runChunk(chunk);
+        }
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+        for (const std::exception_ptr &error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    /**
+     * @brief filter the list like SortedList::filter, with func called from several threads.
+     * the answers of func are kept in order and the list is then filtered by them,
+     * so the result is identical to list.filter(func). func must be safe to call concurrently.
+     * @param list
+     * @param func
+     * @param threads number of threads, 0 for the number of cores
+     * @return SortedList<T, Alloc> after the filter
+     */
+    template <class T, class Alloc, typename predict>
+    SortedList<T, Alloc> parallelFilter(const SortedList<T, Alloc> &list, predict func, unsigned int threads = 0)
+    {
+        int length = list.length();
+        std::vector<char> keep(length);
+        forEachChunk(list, chunkCount(length, threads),
+                     [&keep, &func](int, int index, typename SortedList<T, Alloc>::const_iterator it, int count)
+                     {
+                         for (int i = 0; i < count; ++i, ++it)
+                         {
+                             keep[index + i] = func(*it) ? 1 : 0;
+                         }
+                     });
+        int index = 0;
+        return list.filter([&keep, &index](const T &)
+                           { return keep[index++] != 0; });
+    }
+
+    /**
+     * @brief apply func on the list like SortedList::apply, with func called from several threads.
+     * the results are sorted once, the result is identical to list.apply(func) and takes its nodes
+     * from the allocator of list. func must be safe to call concurrently.
+     * @param list
+     * @param func
+     * @param threads number of threads, 0 for the number of cores
+     * @return SortedList<T, Alloc> after the apply
+     */
+    template <class T, class Alloc, typename function>
+    SortedList<T, Alloc> parallelApply(const SortedList<T, Alloc> &list, function func, unsigned int threads = 0)
+    {
+        int chunks = chunkCount(list.length(), threads);
+        std::vector<std::vector<T>> results(chunks);
+        forEachChunk(list, chunks,
+                     [&results, &func](int chunk, int, typename SortedList<T, Alloc>::const_iterator it, int count)
+                     {
+                         results[chunk].reserve(count);
+                         for (int i = 0; i < count; ++i, ++it)
+                         {
+                             results[chunk].push_back(func(*it));
+                         }
+                     });
+        std::vector<T> all;
+        all.reserve(list.length());
+        for (int chunk = 0; chunk < chunks; ++chunk)
+        {
+            std::move(results[chunk].begin(), results[chunk].end(), std::back_inserter(all));
+        }
+        return SortedList<T, Alloc>(std::make_move_iterator(all.begin()), std::make_move_iterator(all.end()),
+                                    list.get_allocator());
+    }
+}
+
+#endif
@@ -0,0 +1,658 @@
+#ifndef PERSISTENT_SORTED_LIST_H
+#define PERSISTENT_SORTED_LIST_H
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace mtm
+{
+
+    template <class T>
+    class PersistentSortedList;
+
+    /*=======================================================================*/
+    /*====================== class PersistentNode ===========================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief immutable treap node, shared by all the versions of the list that contain it
+     */
+    template <class T>
+    class PersistentNode
+    {
+        typedef std::shared_ptr<const PersistentNode<T>> Link;
+
+        T data;
+        unsigned int priority;
+        int size;
+        Link left;
+        Link right;
+
+    public:
+        /**
+         * @brief constructor of a node with its children, the size is counted from them
+         * @param data
+         * @param priority
+         * @param left
+         * @param right
+         */
+        PersistentNode(T data, unsigned int priority, Link left, Link right)
+            : data(std::move(data)), priority(priority),
+              size(1 + (left ? left->size : 0) + (right ? right->size : 0)),
+              left(std::move(left)), right(std::move(right)) {}
+        PersistentNode(const PersistentNode<T> &node) = delete;
+        PersistentNode<T> &operator=(const PersistentNode<T> &node) = delete;
+        ~PersistentNode() = default;
+        friend class PersistentSortedList<T>;
+    };
+
+    /*=======================================================================*/
+    /*==================== class PersistentSortedList =======================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief sorted list with the SortedList interface whose copies are O(1):
+     * the elements are kept in a treap of immutable nodes, a copy shares the root, and a change
+     * copies only the O(log n) nodes on the path it touches, so the other copies never see it.
+     * equal elements are kept in insertion order, like in SortedList.
+     * an iterator holds the root of the version of the list it was taken from, so it stays valid
+     * (and keeps walking that version) after the list is changed or destroyed.
+     */
+    template <class T>
+    class PersistentSortedList
+    {
+        typedef PersistentNode<T> Node;
+        typedef std::shared_ptr<const Node> Link;
+
+        Link root;
+        unsigned int seed;
+
+        /**
+         * @brief draws the priority of a new node
+         */
+        unsigned int randomPriority();
+        static int sizeOf(const Link &node);
+        /**
+         * @brief a copy of the node with other children
+         */
+        static Link withChildren(const Link &node, Link left, Link right);
+        /**
+         * @brief splits the treap to the elements that are not bigger than value and the bigger ones
+         */
+        static std::pair<Link, Link> splitAfter(const Link &node, const T &value);
+        /**
+         * @brief splits the treap to its first count elements and the rest
+         */
+        static std::pair<Link, Link> splitAt(const Link &node, int count);
+        /**
+         * @brief joins two treaps, all the elements of first come before the elements of second
+         */
+        static Link merge(const Link &first, const Link &second);
+        /**
+         * @brief builds a balanced treap of sorted elements [begin, end), depth is the depth of its root
+         */
+        static Link build(std::vector<T> &elements, int begin, int end, int depth);
+        /**
+         * @brief the treap without the elements func returns true for (func is called in order),
+         * the subtrees that lose nothing are shared and not copied
+         */
+        template <typename predict>
+        static Link without(const Link &node, predict &func, int &removed);
+
+    public:
+        class const_iterator;
+
+        /**
+         * @brief PersistentSortedList constructor
+         */
+        PersistentSortedList();
+        /**
+         * @brief PersistentSortedList constructor from the elements of a range, in any order
+         * @param first
+         * @param last
+         */
+        template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+        PersistentSortedList(InputIt first, InputIt last);
+        /**
+         * @brief PersistentSortedList copy constructor, O(1), the nodes are shared
+         * @param list
+         */
+        PersistentSortedList(const PersistentSortedList<T> &list) = default;
+        /**
+         * @brief PersistentSortedList destructor, frees the nodes no other copy shares
+         */
+        ~PersistentSortedList() = default;
+        /**
+         * @brief PersistentSortedList operator=, O(1)
+         * @param list
+         * @return PersistentSortedList<T>
+         */
+        PersistentSortedList<T> &operator=(const PersistentSortedList<T> &list) = default;
+
+        /**
+         * @brief insert a copy of the element to the list, in O(log n)
+         * @param element
+         * @return true if success , false if doesn't
+         */
+        bool insert(const T &element);
+        /**
+         * @brief insert the element to the list, in O(log n)
+         * @param element
+         * @return true if success , false if doesn't
+         */
+        bool insert(T &&element);
+        /**
+         * @brief remove element from the list in O(log n), it must be an iterator of the current version
+         * of this list (or of a copy that wasn't changed since)
+         * @param it
+         * @return const_iterator to the element that was after the removed one
+         */
+        const_iterator remove(const const_iterator &it);
+        /**
+         * @brief remove all the elements that func returns true for, in O(n) calls of func,
+         * only the paths to the removed elements are copied
+         * @param func
+         * @return int number of removed elements
+         */
+        template <typename predict>
+        int remove_if(predict func);
+        /**
+         * @brief get the length of the list
+         * @return int length
+         */
+        int length() const;
+        /**
+         * @brief get the first iterator of the list
+         * @return const_iterator
+         */
+        const_iterator begin() const;
+        /**
+         * @brief get the last iterator of the list
+         * @return const_iterator
+         */
+        const_iterator end() const;
+
+        /**
+         * @brief filter the list with the predict func and return the filtered list
+         * @param func
+         * @return PersistentSortedList<T> after the filter
+         */
+        template <typename predict>
+        PersistentSortedList<T> filter(predict func) const;
+        /**
+         * @brief returns a new list after changes of the elements that made by the func function
+         * @param func
+         * @return PersistentSortedList<T> after the apply
+         */
+        template <typename function>
+        PersistentSortedList<T> apply(function func) const;
+    };
+
+    /**
+     * @brief default c`tor.
+     */
+    template <class T>
+    PersistentSortedList<T>::PersistentSortedList() : root(nullptr), seed(0x2545f491u) {}
+
+    /**
+     * @brief range c`tor, the elements are sorted once (stable) and built into a balanced treap.
+     * @param first iterator to the first element to insert.
+     * @param last iterator after the last element to insert.
+     */
+    template <class T>
+    template <class InputIt, class>
+    PersistentSortedList<T>::PersistentSortedList(InputIt first, InputIt last) : PersistentSortedList()
+    {
+        std::vector<T> elements(first, last);
+        std::stable_sort(elements.begin(), elements.end());
+        root = build(elements, 0, (int)elements.size(), 0);
+    }
+
+    /**
+     * @brief xorshift step on the list seed.
+     * @return priority of the next node.
+     */
+    template <class T>
+    unsigned int PersistentSortedList<T>::randomPriority()
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    }
+
+    template <class T>
+    int PersistentSortedList<T>::sizeOf(const Link &node)
+    {
+        return node ? node->size : 0;
+    }
+
+    template <class T>
+    typename PersistentSortedList<T>::Link PersistentSortedList<T>::withChildren(const Link &node, Link left,
+                                                                                 Link right)
+    {
+        return std::make_shared<const Node>(node->data, node->priority, std::move(left), std::move(right));
+    }
+
+    /**
+     * @brief split by value, copies the nodes on the search path of value.
+     * @return the treap of the elements that are not bigger than value, and the treap of the rest.
+     */
+    template <class T>
+    std::pair<typename PersistentSortedList<T>::Link, typename PersistentSortedList<T>::Link>
+    PersistentSortedList<T>::splitAfter(const Link &node, const T &value)
+    {
+        if (!node)
+        {
+            return std::pair<Link, Link>(nullptr, nullptr);
+        }
+        if (value < node->data)
+        {
+            std::pair<Link, Link> parts = splitAfter(node->left, value);
+            return std::pair<Link, Link>(parts.first, withChildren(node, parts.second, node->right));
+        }
+        std::pair<Link, Link> parts = splitAfter(node->right, value);
+        return std::pair<Link, Link>(withChildren(node, node->left, parts.first), parts.second);
+    }
+
+    /**
+     * @brief split by position, copies the nodes on the path to the count-th element.
+     * @return the treap of the first count elements, and the treap of the rest.
+     */
+    template <class T>
+    std::pair<typename PersistentSortedList<T>::Link, typename PersistentSortedList<T>::Link>
+    PersistentSortedList<T>::splitAt(const Link &node, int count)
+    {
+        if (!node)
+        {
+            return std::pair<Link, Link>(nullptr, nullptr);
+        }
+        if (count <= sizeOf(node->left))
+        {
+            std::pair<Link, Link> parts = splitAt(node->left, count);
+            return std::pair<Link, Link>(parts.first, withChildren(node, parts.second, node->right));
+        }
+        std::pair<Link, Link> parts = splitAt(node->right, count - sizeOf(node->left) - 1);
+        return std::pair<Link, Link>(withChildren(node, node->left, parts.first), parts.second);
+    }
+
+    /**
+     * @brief merge, copies the nodes on the right spine of first and the left spine of second it goes through.
+     * @return the joined treap.
+     */
+    template <class T>
+    typename PersistentSortedList<T>::Link PersistentSortedList<T>::merge(const Link &first, const Link &second)
+    {
+        if (!first)
+        {
+            return second;
+        }
+        if (!second)
+        {
+            return first;
+        }
+        if (first->priority > second->priority)
+        {
+            return withChildren(first, first->left, merge(first->right, second));
+        }
+        return withChildren(second, merge(first, second->left), second->right);
+    }
+
+    /**
+     * @brief builds a perfectly balanced treap, the priorities go down with the depth so the
+     * heap order holds, and nodes inserted later (with random priorities) sink below it.
+     */
+    template <class T>
+    typename PersistentSortedList<T>::Link PersistentSortedList<T>::build(std::vector<T> &elements, int begin,
+                                                                          int end, int depth)
+    {
+        if (begin >= end)
+        {
+            return nullptr;
+        }
+        int middle = begin + (end - begin) / 2;
+        Link left = build(elements, begin, middle, depth + 1);
+        Link right = build(elements, middle + 1, end, depth + 1);
+        return std::make_shared<const Node>(std::move(elements[middle]), ~0u - depth, std::move(left), std::move(right));
+    }
+
+    /**
+     * @brief Insert funtion, the element goes after the elements equal to it.
+     * @param element element to copy into the list.
+     * @return
+     */
+    template <class T>
+    bool PersistentSortedList<T>::insert(const T &element)
+    {
+        return insert(T(element));
+    }
+
+    /**
+     * @brief Insert funtion.
+     * @param element element to move into the list.
+     * @return
+     */
+    template <class T>
+    bool PersistentSortedList<T>::insert(T &&element)
+    {
+        std::pair<Link, Link> parts = splitAfter(root, element);
+        Link node = std::make_shared<const Node>(std::move(element), randomPriority(), nullptr, nullptr);
+        root = merge(merge(parts.first, node), parts.second);
+        return true;
+    }
+
+    /**
+     * @brief remove element with his iterator.
+     * @param it iterator pointing to the element to remove, must belong to this version of the list.
+     * @return iterator to the next element (end() if the last element was removed).
+     * @exception invalid_argument if it is an iterator of another version (its rank would point at a
+     * different element here).
+     * @exception out_of_range if it is end().
+     */
+    template <class T>
+    typename PersistentSortedList<T>::const_iterator PersistentSortedList<T>::remove(const const_iterator &it)
+    {
+        if (it.root != root)
+        {
+            throw std::invalid_argument("Iterator of another version");
+        }
+        if (it.path.empty())
+        {
+            throw std::out_of_range("End of List");
+        }
+        std::pair<Link, Link> before = splitAt(root, it.rank);
+        std::pair<Link, Link> after = splitAt(before.second, 1);
+        root = merge(before.first, after.second);
+        return const_iterator(root, it.rank);
+    }
+
+    /**
+     * @brief removes from the subtree in order: the left subtree, the node, then the right subtree.
+     * a removed node is replaced by the merge of its children, a node above a removed one is copied,
+     * any other node is shared as it is.
+     * @return the subtree without the removed elements.
+     */
+    template <class T>
+    template <typename predict>
+    typename PersistentSortedList<T>::Link PersistentSortedList<T>::without(const Link &node, predict &func,
+                                                                            int &removed)
+    {
+        if (!node)
+        {
+            return nullptr;
+        }
+        int removed_before = removed;
+        Link left = without(node->left, func, removed);
+        bool remove_node = func(node->data);
+        Link right = without(node->right, func, removed);
+        if (remove_node)
+        {
+            removed++;
+            return merge(left, right);
+        }
+        if (removed == removed_before)
+        {
+            return node;
+        }
+        return withChildren(node, std::move(left), std::move(right));
+    }
+
+    /**
+     * @brief remove_if function.
+     * @param func boolean function, the elements it returns true for are removed.
+     * @return number of removed elements.
+     */
+    template <class T>
+    template <typename predict>
+    int PersistentSortedList<T>::remove_if(predict func)
+    {
+        int removed = 0;
+        Link new_root = without(root, func, removed);
+        root = std::move(new_root);
+        return removed;
+    }
+
+    /**
+     * @brief length function.
+     * @return length of the list (number of nodes\elements)
+     */
+    template <class T>
+    int PersistentSortedList<T>::length() const
+    {
+        return sizeOf(root);
+    }
+
+    /**
+     * @return const_iterator to the beggining of the list
+     */
+    template <class T>
+    typename PersistentSortedList<T>::const_iterator PersistentSortedList<T>::begin() const
+    {
+        return const_iterator(root, 0);
+    }
+
+    /**
+     * @return const_iterator to the end of the list.
+     */
+    template <class T>
+    typename PersistentSortedList<T>::const_iterator PersistentSortedList<T>::end() const
+    {
+        return const_iterator(root, length());
+    }
+
+    /**
+     * @brief filter function, the new list shares with this one the subtrees where nothing is filtered out.
+     * @param func filter function to use when filtering the list (boolean)
+     * @return new list created by appling the filter on the current list.
+     */
+    template <class T>
+    template <typename predict>
+    PersistentSortedList<T> PersistentSortedList<T>::filter(predict func) const
+    {
+        PersistentSortedList<T> new_list(*this);
+        new_list.remove_if([&func](const T &element)
+                           { return !func(element); });
+        return new_list;
+    }
+
+    /**
+     * @brief apply function.
+     * @param func apply function to edit the current elements of the list
+     * @return new list constructed with the apply function logic.
+     */
+    template <class T>
+    template <typename function>
+    PersistentSortedList<T> PersistentSortedList<T>::apply(function func) const
+    {
+        std::vector<T> results;
+        results.reserve(length());
+        for (const T &element : *this)
+        {
+            results.push_back(func(element));
+        }
+        return PersistentSortedList<T>(std::make_move_iterator(results.begin()), std::make_move_iterator(results.end()));
+    }
+
+    /*=======================================================================*/
+    /*======================= class const_iterator ==========================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief iterator that keeps the path from the root to its node and the position of the node.
+     * it owns a refrence to the root, so the nodes of the path live as long as the iterator.
+     */
+    template <class T>
+    class PersistentSortedList<T>::const_iterator
+    {
+        Link root;
+        std::vector<const Node *> path;
+        int rank;
+
+        /**
+         * @brief const_iterator constructor to the element at the given position
+         * @param root_new
+         * @param rank_new
+         */
+        const_iterator(const Link &root_new, int rank_new);
+
+    public:
+        /**
+         * @brief The default constructor is deleted
+         * @param
+         */
+        const_iterator() = delete;
+        const_iterator(const const_iterator &iterator_new) = default;
+        ~const_iterator() = default;
+        const_iterator &operator=(const const_iterator &iterator_new) = default;
+        /**
+         * @brief const_iterator pre-fix operator ++
+         * @return const_iterator& with the ++ change
+         */
+        const_iterator &operator++();
+        /**
+         * @brief const_iterator post-fix operator ++
+         * @param dummy int parameter
+         * @return const_iterator& without the ++ change
+         */
+        const_iterator operator++(int);
+        /**
+         * @brief boolean operator== for const_iterator
+         * @param iterator_new
+         * @return true if identical , false if doesn't
+         */
+        bool operator==(const const_iterator &iterator_new) const;
+        /**
+         * @brief boolean operator!= for const_iterator
+         * @param iterator_new
+         * @return true if different , false if identical
+         */
+        bool operator!=(const const_iterator &iterator_new) const;
+        /**
+         * @brief operator* for const_iterator
+         * @return the T data of the iterator
+         */
+        const T &operator*() const;
+        friend class PersistentSortedList<T>;
+    };
+
+    /**
+     * @brief walks down from the root to the element at rank_new, keeping the path (empty for the end).
+     */
+    template <class T>
+    PersistentSortedList<T>::const_iterator::const_iterator(const Link &root_new, int rank_new)
+        : root(root_new), rank(rank_new)
+    {
+        const Node *node = root.get();
+        int count = rank_new;
+        while (node != nullptr)
+        {
+            path.push_back(node);
+            int left_size = sizeOf(node->left);
+            if (count == left_size)
+            {
+                return;
+            }
+            if (count < left_size)
+            {
+                node = node->left.get();
+            }
+            else
+            {
+                count -= left_size + 1;
+                node = node->right.get();
+            }
+        }
+        path.clear();
+    }
+
+    /**
+     * @brief prefix ++ operator, goes to the leftmost node of the right subtree, or up to the first
+     * ancestor whose left subtree it leaves.
+     * @return iterator to the next element.
+     * @exception out_of_range if the current iterator is the last one.
+     */
+    template <class T>
+    typename PersistentSortedList<T>::const_iterator &PersistentSortedList<T>::const_iterator::operator++()
+    {
+        if (path.empty())
+        {
+            throw std::out_of_range("End of List");
+        }
+        rank++;
+        const Node *node = path.back();
+        if (node->right)
+        {
+            node = node->right.get();
+            path.push_back(node);
+            while (node->left)
+            {
+                node = node->left.get();
+                path.push_back(node);
+            }
+            return *this;
+        }
+        path.pop_back();
+        while (!path.empty() && path.back()->right.get() == node)
+        {
+            node = path.back();
+            path.pop_back();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief postfix ++ operator, advancing the iterator one element forward.
+     * @return the original iterator
+     * @exception out_of_range if the current iterator is the last one.
+     */
+    template <class T>
+    typename PersistentSortedList<T>::const_iterator PersistentSortedList<T>::const_iterator::operator++(int)
+    {
+        const_iterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    /**
+     * @brief == operator compares the versions and the positions of the iterators
+     * @param iterator_new iterator to compare with
+     * @return true if the same, false else.
+     */
+    template <class T>
+    bool PersistentSortedList<T>::const_iterator::operator==(const const_iterator &iterator_new) const
+    {
+        return root == iterator_new.root && rank == iterator_new.rank;
+    }
+
+    /**
+     * @brief != operator, the opposite of ==
+     * @param iterator_new iterator to compare with
+     * @return true if different, false else.
+     */
+    template <class T>
+    bool PersistentSortedList<T>::const_iterator::operator!=(const const_iterator &iterator_new) const
+    {
+        return !(*this == iterator_new);
+    }
+
+    /**
+     * @brief derefrencing operator.
+     * @return data of the node pointed to by the iterator.
+     * @exception out_of_range if the iterator is end().
+     */
+    template <class T>
+    const T &PersistentSortedList<T>::const_iterator::operator*() const
+    {
+        if (path.empty())
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return path.back()->data;
+    }
+}
+
+#endif
@@ -1,13 +1,18 @@
 #ifndef SORTED_LIST_H
 #define SORTED_LIST_H
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace mtm
 {
 
-    template <class T>
+    template <class T, class Alloc = std::allocator<T>>
     class SortedList;
 
     /*=======================================================================*/
@@ -28,10 +33,11 @@ namespace mtm
          */
         Node() = delete;
         /**
-         * @brief constructor with data parameter
-         * @param data_new
+         * @brief constructor that builds the data in place from the given arguments
+         * @param args arguments forwarded to the T constructor
          */
-        Node(const T data_new);
+        template <typename... Args>
+        explicit Node(Args &&...args);
         /**
          * @brief copy constructor
          * @param node
@@ -48,22 +54,74 @@ namespace mtm
          * @return Node<T>&
          */
         Node<T> &operator=(const Node<T> &node) = default;
-        friend class SortedList<T>;
+        template <class, class>
+        friend class SortedList;
     };
 
     template <class T>
-    Node<T>::Node(const T data_new) : data(data_new), next(nullptr), previous(nullptr) {}
+    template <typename... Args>
+    Node<T>::Node(Args &&...args) : data(std::forward<Args>(args)...), next(nullptr), previous(nullptr) {}
 
     /*=======================================================================*/
     /*========================= class SortedList ============================*/
     /*=======================================================================*/
 
-    template <class T>
+    /**
+     * @brief sorted list of T, its nodes are allocated with Alloc rebound to Node<T>
+     * (std::allocator by default, see nodePool.h for a pooled allocator).
+     */
+    template <class T, class Alloc>
     class SortedList
     {
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node<T>> NodeAlloc;
+        typedef std::allocator_traits<NodeAlloc> NodeAllocTraits;
+
+        NodeAlloc alloc;
         Node<T> *head;
+        Node<T> *tail;
         int size;
 
+        /**
+         * @brief allocates a node with the list allocator and constructs it from the arguments
+         * @param args arguments forwarded to the T constructor
+         * @return Node<T>* the new node, not linked
+         */
+        template <typename... Args>
+        Node<T> *createNode(Args &&...args);
+        /**
+         * @brief destructs the node and gives its memory back to the list allocator
+         * @param node
+         */
+        void destroyNode(Node<T> *node);
+        /**
+         * @brief links a new node into its sorted place, after the elements equal to it
+         * @param new_node
+         */
+        void link(Node<T> *new_node);
+        /**
+         * @brief links a new node after the last node, the node must not be smaller than it
+         * @param new_node
+         */
+        void linkLast(Node<T> *new_node);
+        /**
+         * @brief merges a sorted chain of linked nodes into the list in one pass,
+         * the list elements stay before the chain elements equal to them
+         * @param first first node of the chain
+         * @param last last node of the chain
+         * @param count number of nodes in the chain
+         */
+        void mergeNodes(Node<T> *first, Node<T> *last, int count);
+        /**
+         * @brief unlinks the node from the list and deletes it
+         * @param node
+         * @return the node that was after it (nullptr if it was the last)
+         */
+        Node<T> *unlink(Node<T> *node);
+        /**
+         * @brief deletes all the nodes of the list
+         */
+        void clear();
+
     public:
         class const_iterator;
 
@@ -71,11 +129,29 @@ namespace mtm
          * @brief SortedList constructor
          */
         SortedList();
+        /**
+         * @brief SortedList constructor with the allocator to take the nodes from
+         * @param allocator
+         */
+        explicit SortedList(const Alloc &allocator);
+        /**
+         * @brief SortedList constructor from the elements of a range, in any order
+         * @param first
+         * @param last
+         * @param allocator
+         */
+        template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+        SortedList(InputIt first, InputIt last, const Alloc &allocator = Alloc());
         /**
          * @brief SortedList copy constructor
          * @param list
          */
-        SortedList(const SortedList<T> &list);
+        SortedList(const SortedList<T, Alloc> &list);
+        /**
+         * @brief SortedList move constructor, takes the nodes of list and leaves it empty
+         * @param list
+         */
+        SortedList(SortedList<T, Alloc> &&list) noexcept;
         /**
          * @brief SortedList destructor
          */
@@ -83,27 +159,70 @@ namespace mtm
         /**
          * @brief SortedList operator=
          * @param list
-         * @return SortedList<T>
+         * @return SortedList<T, Alloc>
+         */
+        SortedList<T, Alloc> &operator=(const SortedList<T, Alloc> &list);
+        /**
+         * @brief SortedList move operator=, takes the nodes of list and leaves it empty
+         * @param list
+         * @return SortedList<T, Alloc>
          */
-        SortedList<T> &operator=(const SortedList<T> &list);
+        SortedList<T, Alloc> &operator=(SortedList<T, Alloc> &&list) noexcept;
 
         /**
-         * @brief insert new element to the list
+         * @brief insert a copy of the element to the list
          * @param element
          * @return true if success , false if doesn't
          */
-        bool insert(const T element);
+        bool insert(const T &element);
         /**
-         * @brief remove element from the list
-         * @param it
+         * @brief insert the element to the list by moving it into the new node
+         * @param element
          * @return true if success , false if doesn't
          */
-        bool remove(const SortedList<T>::const_iterator &it);
+        bool insert(T &&element);
+        /**
+         * @brief insert new element to the list, constructed in place in the new node
+         * @param args arguments forwarded to the T constructor
+         * @return true if success , false if doesn't
+         */
+        template <typename... Args>
+        bool emplace(Args &&...args);
+        /**
+         * @brief insert copies of all the elements of the range, sorted once and merged into the list
+         * @param first
+         * @param last
+         */
+        template <class InputIt>
+        void insert(InputIt first, InputIt last);
+        /**
+         * @brief merge the elements of another list into this one in linear time, list is left empty
+         * @param list
+         */
+        void merge(SortedList<T, Alloc> &&list);
+        /**
+         * @brief remove element from the list in O(1), it must be an iterator of this list
+         * @param it
+         * @return const_iterator to the element that was after the removed one
+         */
+        const_iterator remove(const SortedList<T, Alloc>::const_iterator &it);
+        /**
+         * @brief remove all the elements that func returns true for, in one pass
+         * @param func
+         * @return int number of removed elements
+         */
+        template <typename predict>
+        int remove_if(predict func);
         /**
          * @brief get the length of the list
          * @return int length
          */
-        int length();
+        int length() const;
+        /**
+         * @brief get the allocator the list takes its nodes from
+         * @return Alloc
+         */
+        Alloc get_allocator() const;
         /**
          * @brief get the first iterator of the list
          * @return const_iterator
@@ -118,101 +237,382 @@ namespace mtm
         /**
          * @brief filter the list with the predict func and return the filtered list
          * @param func
-         * @return SortedList<T> after the filter
+         * @return SortedList<T, Alloc> after the filter
          */
         template <typename predict>
-        SortedList<T> filter(predict func) const;
+        SortedList<T, Alloc> filter(predict func) const &;
+        /**
+         * @brief filter a temporary list in place, the kept nodes are reused without copying
+         * @param func
+         * @return SortedList<T, Alloc> after the filter
+         */
+        template <typename predict>
+        SortedList<T, Alloc> filter(predict func) &&;
         /**
          * @brief returns a new list after changes of the elements that made by the func function  
          * @param func
-         * @return SortedList<T> after the apply
+         * @return SortedList<T, Alloc> after the apply
          */
         template <typename function>
-        SortedList<T> apply(function func) const;
+        SortedList<T, Alloc> apply(function func) const &;
+        /**
+         * @brief apply on a temporary list, the elements are moved into func
+         * @param func
+         * @return SortedList<T, Alloc> after the apply
+         */
+        template <typename function>
+        SortedList<T, Alloc> apply(function func) &&;
     };
 
     /**
      * @brief default c`tor.
      */
-    template <class T>
-    SortedList<T>::SortedList()
+    template <class T, class Alloc>
+    SortedList<T, Alloc>::SortedList() : SortedList(Alloc()) {}
+
+    /**
+     * @brief c`tor with allocator.
+     * @param allocator allocator (or pool) for the nodes of the list.
+     */
+    template <class T, class Alloc>
+    SortedList<T, Alloc>::SortedList(const Alloc &allocator) : alloc(allocator)
     {
         this->head = nullptr;
+        this->tail = nullptr;
         this->size = 0;
     }
 
     /**
-     * @brief copy c`tor.
+     * @brief range c`tor.
+     * @param first iterator to the first element to insert.
+     * @param last iterator after the last element to insert.
+     * @param allocator allocator (or pool) for the nodes of the list.
+     */
+    template <class T, class Alloc>
+    template <class InputIt, class>
+    SortedList<T, Alloc>::SortedList(InputIt first, InputIt last, const Alloc &allocator) : SortedList(allocator)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * @brief copy c`tor, if copying an element throws the nodes copied so far are deleted.
      * @param list list to copy.
      */
-    template <class T>
-    SortedList<T>::SortedList(const SortedList<T> &list) : head(nullptr), size(0)
+    template <class T, class Alloc>
+    SortedList<T, Alloc>::SortedList(const SortedList<T, Alloc> &list)
+        : alloc(NodeAllocTraits::select_on_container_copy_construction(list.alloc)),
+          head(nullptr), tail(nullptr), size(0)
     {
-        Node<T> *temp = list.head;
-        while (temp != nullptr)
+        try
         {
-            this->insert(temp->data);
-            temp = temp->next;
+            for (Node<T> *temp = list.head; temp != nullptr; temp = temp->next)
+            {
+                linkLast(createNode(temp->data));
+            }
+        }
+        catch (...)
+        {
+            clear();
+            throw;
         }
-        this->size = list.size;
+    }
+
+    /**
+     * @brief move c`tor.
+     * @param list list to take the nodes from, left empty.
+     */
+    template <class T, class Alloc>
+    SortedList<T, Alloc>::SortedList(SortedList<T, Alloc> &&list) noexcept
+        : alloc(list.alloc), head(list.head), tail(list.tail), size(list.size)
+    {
+        list.head = nullptr;
+        list.tail = nullptr;
+        list.size = 0;
     }
 
     /**
      * @brief d`tor.
      */
-    template <class T>
-    SortedList<T>::~SortedList()
+    template <class T, class Alloc>
+    SortedList<T, Alloc>::~SortedList()
+    {
+        clear();
+    }
+
+    /**
+     * @brief deletes all the nodes, the list is left empty.
+     */
+    template <class T, class Alloc>
+    void SortedList<T, Alloc>::clear()
     {
         Node<T> *temp = this->head;
         while (temp != nullptr)
         {
             Node<T> *to_delete = temp;
             temp = temp->next;
-            delete to_delete;
+            destroyNode(to_delete);
         }
+        this->head = nullptr;
+        this->tail = nullptr;
+        this->size = 0;
     }
 
     /**
-     * @brief operator = for assigning.
+     * @brief operator = for assigning, copy and swap: the copy is made (with this list allocator)
+     * before anything is deleted, so if copying an element throws this list is unchanged.
      * @param list list to assign.
      * @return list copy to assign to this list.
      */
-    template <class T>
-    SortedList<T> &SortedList<T>::operator=(const SortedList<T> &list)
+    template <class T, class Alloc>
+    SortedList<T, Alloc> &SortedList<T, Alloc>::operator=(const SortedList<T, Alloc> &list)
     {
         if (this == &list)
         {
             return *this;
         }
-        Node<T> *temp = this->head;
-        while (temp != nullptr)
+        SortedList<T, Alloc> copy((Alloc(this->alloc)));
+        for (Node<T> *temp = list.head; temp != nullptr; temp = temp->next)
         {
-            Node<T> *to_delete = temp;
-            temp = temp->next;
-            delete to_delete;
+            copy.linkLast(copy.createNode(temp->data));
         }
-        temp = list.head;
-        head = nullptr;
-        size = 0;
-        while (temp != nullptr)
+        std::swap(head, copy.head);
+        std::swap(tail, copy.tail);
+        std::swap(size, copy.size);
+        return *this;
+    }
+
+    /**
+     * @brief move operator = for assigning.
+     * @param list list to take the nodes from, left empty.
+     * @return this list, with the nodes of list.
+     */
+    template <class T, class Alloc>
+    SortedList<T, Alloc> &SortedList<T, Alloc>::operator=(SortedList<T, Alloc> &&list) noexcept
+    {
+        if (this == &list)
         {
-            this->insert(temp->data);
-            temp = temp->next;
+            return *this;
         }
+        clear();
+        alloc = list.alloc;
+        head = list.head;
+        tail = list.tail;
         size = list.size;
+        list.head = nullptr;
+        list.tail = nullptr;
+        list.size = 0;
         return *this;
     }
 
-    template <class T>
+    template <class T, class Alloc>
+    /**
+     * @brief Insert funtion.
+     * @param element element to copy into the list.
+     * @return 
+     */
+    bool SortedList<T, Alloc>::insert(const T &element)
+    {
+        return emplace(element);
+    }
+
+    template <class T, class Alloc>
     /**
      * @brief Insert funtion.
-     * @param element element to insert.
+     * @param element element to move into the list.
      * @return 
      */
-    bool SortedList<T>::insert(const T element)
+    bool SortedList<T, Alloc>::insert(T &&element)
     {
-        Node<T> *new_node = new Node<T>(element);
-        Node<T> *last_node = nullptr;
+        return emplace(std::move(element));
+    }
+
+    template <class T, class Alloc>
+    /**
+     * @brief Emplace funtion, the element is constructed once, directly in its node.
+     * @param args arguments for the element`s constructor.
+     * @return 
+     */
+    template <typename... Args>
+    bool SortedList<T, Alloc>::emplace(Args &&...args)
+    {
+        link(createNode(std::forward<Args>(args)...));
+        return true;
+    }
+
+    template <class T, class Alloc>
+    /**
+     * @brief range insert funtion, the elements are copied once and sorted (skipped if the range
+     * is already sorted), then moved into nodes allocated in their final order and merged into the list.
+     * equal elements keep their order, after the equal elements already in the list.
+     * @param first iterator to the first element to insert.
+     * @param last iterator after the last element to insert.
+     */
+    template <class InputIt>
+    void SortedList<T, Alloc>::insert(InputIt first, InputIt last)
+    {
+        std::vector<T> elements(first, last);
+        if (!std::is_sorted(elements.begin(), elements.end()))
+        {
+            std::stable_sort(elements.begin(), elements.end());
+        }
+        SortedList<T, Alloc> sorted((Alloc(this->alloc)));
+        for (T &element : elements)
+        {
+            sorted.linkLast(sorted.createNode(std::move(element)));
+        }
+        merge(std::move(sorted));
+    }
+
+    template <class T, class Alloc>
+    /**
+     * @brief merge funtion, the nodes of list are spliced into this list when both use the same
+     * allocator, else the elements are moved into new nodes first.
+     * @param list sorted list to merge, left empty.
+     */
+    void SortedList<T, Alloc>::merge(SortedList<T, Alloc> &&list)
+    {
+        if (this == &list || list.head == nullptr)
+        {
+            return;
+        }
+        if (!(this->alloc == list.alloc))
+        {
+            SortedList<T, Alloc> moved((Alloc(this->alloc)));
+            for (Node<T> *node = list.head; node != nullptr; node = node->next)
+            {
+                moved.linkLast(moved.createNode(std::move(node->data)));
+            }
+            list.clear();
+            merge(std::move(moved));
+            return;
+        }
+        Node<T> *first = list.head;
+        Node<T> *last = list.tail;
+        int count = list.size;
+        list.head = nullptr;
+        list.tail = nullptr;
+        list.size = 0;
+        mergeNodes(first, last, count);
+    }
+
+    template <class T, class Alloc>
+    /**
+     * @brief merges the chain with the list nodes like in merge sort, relinking the nodes in place.
+     * a chain that goes entirely after (or before) the list is linked in O(1).
+     * @param first first node of a sorted chain.
+     * @param last last node of the chain.
+     * @param count number of nodes in the chain.
+     */
+    void SortedList<T, Alloc>::mergeNodes(Node<T> *first, Node<T> *last, int count)
+    {
+        this->size += count;
+        if (this->head == nullptr)
+        {
+            this->head = first;
+            this->tail = last;
+            return;
+        }
+        if (!(first->data < this->tail->data))
+        {
+            this->tail->next = first;
+            first->previous = this->tail;
+            this->tail = last;
+            return;
+        }
+        if (last->data < this->head->data)
+        {
+            last->next = this->head;
+            this->head->previous = last;
+            this->head = first;
+            return;
+        }
+        Node<T> *mine = this->head;
+        Node<T> *theirs = first;
+        Node<T> *merged_head = nullptr;
+        Node<T> *merged_tail = nullptr;
+        while (mine != nullptr && theirs != nullptr)
+        {
+            Node<T> *next;
+            if (theirs->data < mine->data)
+            {
+                next = theirs;
+                theirs = theirs->next;
+            }
+            else
+            {
+                next = mine;
+                mine = mine->next;
+            }
+            next->previous = merged_tail;
+            if (merged_tail == nullptr)
+            {
+                merged_head = next;
+            }
+            else
+            {
+                merged_tail->next = next;
+            }
+            merged_tail = next;
+        }
+        Node<T> *rest = mine != nullptr ? mine : theirs;
+        rest->previous = merged_tail;
+        merged_tail->next = rest;
+        if (mine == nullptr)
+        {
+            this->tail = last;
+        }
+        this->head = merged_head;
+    }
+
+    template <class T, class Alloc>
+    /**
+     * @brief allocates the node memory and constructs the node in it, the memory is
+     * given back if the T constructor throws.
+     * @param args arguments for the element`s constructor.
+     * @return the new node.
+     */
+    template <typename... Args>
+    Node<T> *SortedList<T, Alloc>::createNode(Args &&...args)
+    {
+        Node<T> *node = NodeAllocTraits::allocate(alloc, 1);
+        try
+        {
+            NodeAllocTraits::construct(alloc, node, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            NodeAllocTraits::deallocate(alloc, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    template <class T, class Alloc>
+    /**
+     * @brief destructs the node and deallocates its memory.
+     * @param node node that is no longer linked in the list.
+     */
+    void SortedList<T, Alloc>::destroyNode(Node<T> *node)
+    {
+        NodeAllocTraits::destroy(alloc, node);
+        NodeAllocTraits::deallocate(alloc, node, 1);
+    }
+
+    template <class T, class Alloc>
+    /**
+     * @brief links the node before the first element bigger than it.
+     * elements that are not smaller than the last one are appended in O(1).
+     * @param new_node node to link, owned by the list from now on.
+     */
+    void SortedList<T, Alloc>::link(Node<T> *new_node)
+    {
+        const T &element = new_node->data;
+        if (this->tail == nullptr || !(element < this->tail->data))
+        {
+            linkLast(new_node);
+            return;
+        }
         for (Node<T> *it = this->head; it != nullptr; it = it->next)
         {
             if (element < it->data)
@@ -229,103 +629,171 @@ namespace mtm
                 {
                     this->head = new_node;
                 }
-                return true;
+                return;
             }
-            last_node = it;
         }
+    }
+
+    template <class T, class Alloc>
+    /**
+     * @brief links the node after the last node.
+     * @param new_node node to link, not smaller than the last element.
+     */
+    void SortedList<T, Alloc>::linkLast(Node<T> *new_node)
+    {
         new_node->next = nullptr;
-        new_node->previous = last_node;
-        this->size++;
-        if (last_node == nullptr)
+        new_node->previous = this->tail;
+        if (this->tail == nullptr)
         {
             this->head = new_node;
         }
         else
         {
-            last_node->next = new_node;
+            this->tail->next = new_node;
         }
-        return true;
+        this->tail = new_node;
+        this->size++;
     }
 
-    template <class T>
+    template <class T, class Alloc>
+    /**
+     * @brief unlinks the node from its neighbours and deletes it.
+     * @param node node of this list.
+     * @return the next node.
+     */
+    Node<T> *SortedList<T, Alloc>::unlink(Node<T> *node)
+    {
+        Node<T> *next = node->next;
+        if (node->previous != nullptr)
+        {
+            node->previous->next = next;
+        }
+        else
+        {
+            this->head = next;
+        }
+        if (next != nullptr)
+        {
+            next->previous = node->previous;
+        }
+        else
+        {
+            this->tail = node->previous;
+        }
+        destroyNode(node);
+        this->size--;
+        return next;
+    }
+
+    template <class T, class Alloc>
     /**
-     * @brief remove element with his iterator.
-     * @param it iterator pointing to the element to remove.
-     * @return true if succesful, false if element not found.
+     * @brief remove element with his iterator, the node is unlinked directly.
+     * @param it iterator pointing to the element to remove, must belong to this list.
+     * @return iterator to the next element (end() if the last element was removed),
+     * so elements can be removed while iterating.
+     * @exception out_of_range if it is end().
      */
-    bool SortedList<T>::remove(const SortedList<T>::const_iterator &it)
+    typename SortedList<T, Alloc>::const_iterator SortedList<T, Alloc>::remove(const SortedList<T, Alloc>::const_iterator &it)
     {
         if (it.node == nullptr)
         {
             throw std::out_of_range("End of List");
         }
-        for (Node<T> *node = this->head; node != nullptr; node = node->next)
+        return const_iterator(unlink(it.node));
+    }
+
+    template <class T, class Alloc>
+    /**
+     * @brief remove_if function.
+     * @param func boolean function, the elements it returns true for are removed.
+     * @return number of removed elements.
+     */
+    template <typename predict>
+    int SortedList<T, Alloc>::remove_if(predict func)
+    {
+        int removed = 0;
+        Node<T> *node = this->head;
+        while (node != nullptr)
         {
-            if ((node->previous == it.node->previous) &&
-                (node->next == it.node->next))
+            if (func(node->data))
             {
-                if (node->previous != nullptr)
-                {
-                    node->previous->next = node->next;
-                }
-                else
-                {
-                    this->head = node->next;
-                }
-                if (node->next != nullptr)
-                {
-                    node->next->previous = node->previous;
-                }
-                delete node;
-                this->size--;
-                return true;
+                node = unlink(node);
+                removed++;
+            }
+            else
+            {
+                node = node->next;
             }
         }
-        return false;
+        return removed;
     }
 
-    template <class T>
+    template <class T, class Alloc>
     /**
      * @brief length function.
      * @return length of the list (number of nodes\elements)
      */
-    int SortedList<T>::length()
+    int SortedList<T, Alloc>::length() const
     {
         return this->size;
     }
 
+    template <class T, class Alloc>
+    /**
+     * @brief allocator function.
+     * @return copy of the allocator of the list (a NodePool copy shares the arena of the list).
+     */
+    Alloc SortedList<T, Alloc>::get_allocator() const
+    {
+        return Alloc(this->alloc);
+    }
+
     /**
      * @brief filter function
      * @param func filter function to use when filtering the list (boolean)
      * example - only choose the odd elements in the list.
      * @return new list created by appling the filter on the current list.
      */
-    template <class T>
+    template <class T, class Alloc>
     template <typename predict>
-    SortedList<T> SortedList<T>::filter(predict func) const
+    SortedList<T, Alloc> SortedList<T, Alloc>::filter(predict func) const &
     {
-        SortedList<T> new_list;
+        SortedList<T, Alloc> new_list((Alloc(alloc)));
         for (Node<T> *node = this->head; node != nullptr; node = node->next)
         {
             if (func(node->data))
             {
-                new_list.insert(node->data);
+                new_list.linkLast(new_list.createNode(node->data));
             }
         }
         return new_list;
     }
 
+    /**
+     * @brief filter on a temporary list, the nodes that pass the filter are kept as they are.
+     * @param func filter function to use when filtering the list (boolean)
+     * @return the list itself (moved) after unlinking and deleting the nodes that didnt pass.
+     */
+    template <class T, class Alloc>
+    template <typename predict>
+    SortedList<T, Alloc> SortedList<T, Alloc>::filter(predict func) &&
+    {
+        remove_if([&func](const T &element)
+                  { return !func(element); });
+        return std::move(*this);
+    }
+
     /**
      * @brief 
      * @param func apply function to edit the current elements of the list
      * example - double the value of each element (if int).
      * @return new list constructed with the apply function logic.
      */
-    template <class T>
+    template <class T, class Alloc>
     template <typename function>
-    SortedList<T> SortedList<T>::apply(function func) const
+    SortedList<T, Alloc> SortedList<T, Alloc>::apply(function func) const &
     {
-        SortedList<T> new_list;
+        SortedList<T, Alloc> new_list((Alloc(alloc)));
         for (Node<T> *node = this->head; node != nullptr; node = node->next)
         {
             new_list.insert(func(node->data));
@@ -333,11 +801,29 @@ namespace mtm
         return new_list;
     }
 
+    /**
+     * @brief apply on a temporary list.
+     * @param func apply function, gets each element as an rvalue so it can reuse it.
+     * @return new list constructed with the apply function logic.
+     */
+    template <class T, class Alloc>
+    template <typename function>
+    SortedList<T, Alloc> SortedList<T, Alloc>::apply(function func) &&
+    {
+        SortedList<T, Alloc> new_list((Alloc(alloc)));
+        for (Node<T> *node = this->head; node != nullptr; node = node->next)
+        {
+            new_list.insert(func(std::move(node->data)));
+        }
+        clear();
+        return new_list;
+    }
+
     /**
      * @return const_iterator to the beggining of the list
      */
-    template <class T>
-    typename SortedList<T>::const_iterator SortedList<T>::begin() const
+    template <class T, class Alloc>
+    typename SortedList<T, Alloc>::const_iterator SortedList<T, Alloc>::begin() const
     {
         return const_iterator(this->head);
     }
@@ -345,22 +831,18 @@ namespace mtm
     /**
      * @return const_iterator to the end of the list (null).
      */
-    template <class T>
-    typename SortedList<T>::const_iterator SortedList<T>::end() const
+    template <class T, class Alloc>
+    typename SortedList<T, Alloc>::const_iterator SortedList<T, Alloc>::end() const
     {
-        Node<T> *node;
-        for (node = this->head; node != nullptr; node = node->next)
-        {
-        }
-        return const_iterator(node);
+        return const_iterator(nullptr);
     }
 
     /*=======================================================================*/
     /*======================= class const_iterator ==========================*/
     /*=======================================================================*/
 
-    template <class T>
-    class SortedList<T>::const_iterator
+    template <class T, class Alloc>
+    class SortedList<T, Alloc>::const_iterator
     {
         Node<T> *node;
         /**
@@ -408,12 +890,18 @@ namespace mtm
          * @return true if identical , false if doesn't
          */
         bool operator==(const const_iterator iterator_new) const;
+        /**
+         * @brief boolean operator!= for const_iterator (used by range-for loops)
+         * @param iterator_new
+         * @return true if different , false if identical
+         */
+        bool operator!=(const const_iterator iterator_new) const;
         /**
          * @brief operator* for const_iterator
          * @return the T data of the iterator 
          */
         const T &operator*() const;
-        friend class SortedList<T>;
+        friend class SortedList<T, Alloc>;
     };
 
     /**
@@ -421,8 +909,8 @@ namespace mtm
      * @return iterator to the next element.
      * @exception out_of_range if the current iterator is the last one.
      */
-    template <class T>
-    typename SortedList<T>::const_iterator &SortedList<T>::const_iterator::operator++()
+    template <class T, class Alloc>
+    typename SortedList<T, Alloc>::const_iterator &SortedList<T, Alloc>::const_iterator::operator++()
     {
         if (this->node == nullptr)
         {
@@ -437,10 +925,10 @@ namespace mtm
      * @return the original iterator
      * @exception out_of_range if the current iterator is the last one.
      */
-    template <class T>
-    typename SortedList<T>::const_iterator SortedList<T>::const_iterator::operator++(int)
+    template <class T, class Alloc>
+    typename SortedList<T, Alloc>::const_iterator SortedList<T, Alloc>::const_iterator::operator++(int)
     {
-        SortedList<T>::const_iterator temp = *this;
+        SortedList<T, Alloc>::const_iterator temp = *this;
         if (this->node == nullptr)
         {
             throw std::out_of_range("End of List");
@@ -454,9 +942,9 @@ namespace mtm
      * @param iterator_new iterator to compare with
      * @return true if the same, false else.
      */
-    template <class T>
-    bool SortedList<T>::const_iterator::operator==(
-        const SortedList<T>::const_iterator iterator_new) const
+    template <class T, class Alloc>
+    bool SortedList<T, Alloc>::const_iterator::operator==(
+        const SortedList<T, Alloc>::const_iterator iterator_new) const
     {
         if ((this->node == nullptr && iterator_new.node != nullptr) ||
             ((this->node != nullptr && iterator_new.node == nullptr)))
@@ -475,15 +963,27 @@ namespace mtm
         return false;
     }
 
+    /**
+     * @brief != operator, the opposite of ==
+     * @param iterator_new iterator to compare with
+     * @return true if different, false else.
+     */
+    template <class T, class Alloc>
+    bool SortedList<T, Alloc>::const_iterator::operator!=(
+        const SortedList<T, Alloc>::const_iterator iterator_new) const
+    {
+        return !(*this == iterator_new);
+    }
+
     /**
      * @brief derefrencing operator.
      * @return data of the node pointed to by the iterator.
      * @exception out_of_range if the iterator is nullptr.
      */
-    template <class T>
-    const T &SortedList<T>::const_iterator::operator*() const
+    template <class T, class Alloc>
+    const T &SortedList<T, Alloc>::const_iterator::operator*() const
     {
-        if (this == nullptr || this->node == nullptr)
+        if (this->node == nullptr)
         {
             throw std::out_of_range("Out of range");
         }
@@ -0,0 +1,340 @@
+#ifndef SORTED_LIST_VIEW_H
+#define SORTED_LIST_VIEW_H
+
+#include "sortedList.h"
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mtm
+{
+
+    /**
+     * @brief flag for SortedListView::apply, promises that the function keeps the order of the elements
+     * (x < y means func(x) is not bigger than func(y)), so the result is not sorted again.
+     */
+    enum OrderPreserving
+    {
+        ORDER_PRESERVING
+    };
+
+    /*=======================================================================*/
+    /*========================= pipeline stages =============================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief first stage of every pipeline, pushes the list elements as they are
+     */
+    template <class T>
+    class SourceStage
+    {
+    public:
+        typedef T source_type;
+        typedef T output_type;
+
+        /**
+         * @brief pushes the element to the sink
+         * @param element
+         * @param sink
+         */
+        template <class Sink>
+        void push(const source_type &element, Sink &sink) const
+        {
+            sink(element);
+        }
+    };
+
+    /**
+     * @brief stage that pushes on only the elements of the previous stage that func returns true for
+     */
+    template <class Previous, class predict>
+    class FilterStage
+    {
+        Previous previous;
+        mutable predict func;
+
+    public:
+        typedef typename Previous::source_type source_type;
+        typedef typename Previous::output_type output_type;
+
+        FilterStage(const Previous &previous, predict func) : previous(previous), func(func) {}
+
+        /**
+         * @brief pushes the element through the previous stages, then through the filter to the sink
+         * @param element
+         * @param sink
+         */
+        template <class Sink>
+        void push(const source_type &element, Sink &sink) const
+        {
+            auto next = [this, &sink](const output_type &value)
+            {
+                if (func(value))
+                {
+                    sink(value);
+                }
+            };
+            previous.push(element, next);
+        }
+    };
+
+    /**
+     * @brief stage that pushes on func of every element of the previous stage
+     */
+    template <class Previous, class function>
+    class ApplyStage
+    {
+        typedef typename Previous::output_type input_type;
+
+        Previous previous;
+        mutable function func;
+
+    public:
+        typedef typename Previous::source_type source_type;
+        typedef typename std::decay<decltype(std::declval<function &>()(std::declval<const input_type &>()))>::type output_type;
+
+        ApplyStage(const Previous &previous, function func) : previous(previous), func(func) {}
+
+        /**
+         * @brief pushes the element through the previous stages, then pushes its func result to the sink
+         * @param element
+         * @param sink
+         */
+        template <class Sink>
+        void push(const source_type &element, Sink &sink) const
+        {
+            auto next = [this, &sink](const input_type &value)
+            { sink(func(value)); };
+            previous.push(element, next);
+        }
+    };
+
+    /*=======================================================================*/
+    /*======================= class SortedListView ==========================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief lazy filter/apply pipeline over a SortedList.
+     * filter and apply only add a stage to the pipeline type, nothing is computed until
+     * forEach or collect, which push every list element through all the stages in one pass
+     * without intermediate lists. while Sorted is true the elements come out in order and are
+     * streamed as they are, after an apply without ORDER_PRESERVING the results are sorted once at the end.
+     * equal results keep the order of the list elements they came from.
+     * the results are collected with the allocator of the list (rebound to the result type).
+     * the list must outlive the view.
+     */
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    class SortedListView
+    {
+        typedef typename Pipeline::output_type output_type;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<output_type> ResultAlloc;
+        typedef SortedList<output_type, ResultAlloc> Results;
+
+        const SortedList<T, Alloc> *list;
+        Pipeline pipeline;
+
+        /**
+         * @brief forEach for a view that is already in order, streams the results
+         */
+        template <typename visitor>
+        void forEach(visitor &func, std::true_type) const;
+        /**
+         * @brief forEach for a view that is not in order, collects the results first
+         */
+        template <typename visitor>
+        void forEach(visitor &func, std::false_type) const;
+        /**
+         * @brief collect for a view that is already in order, appends to the list in O(1) each
+         */
+        Results collect(std::true_type) const;
+        /**
+         * @brief collect for a view that is not in order, sorts the results once
+         */
+        Results collect(std::false_type) const;
+
+    public:
+        typedef typename Pipeline::output_type value_type;
+
+        /**
+         * @brief view of the list elements through the pipeline
+         * @param list
+         * @param pipeline
+         */
+        SortedListView(const SortedList<T, Alloc> &list, const Pipeline &pipeline);
+
+        /**
+         * @brief add a filter stage, keeps the elements that func returns true for
+         * @param func
+         * @return the view with the filter at its end
+         */
+        template <typename predict>
+        SortedListView<T, Alloc, FilterStage<Pipeline, predict>, Sorted> filter(predict func) const;
+        /**
+         * @brief add an apply stage, the results will be sorted once when the view is used
+         * @param func
+         * @return the view with the apply at its end
+         */
+        template <typename function>
+        SortedListView<T, Alloc, ApplyStage<Pipeline, function>, false> apply(function func) const;
+        /**
+         * @brief add an apply stage of a function that keeps the order, the results are not sorted again
+         * @param func
+         * @param ORDER_PRESERVING
+         * @return the view with the apply at its end
+         */
+        template <typename function>
+        SortedListView<T, Alloc, ApplyStage<Pipeline, function>, Sorted> apply(function func, OrderPreserving) const;
+
+        /**
+         * @brief calls func on every result of the pipeline, in sorted order
+         * @param func
+         */
+        template <typename visitor>
+        void forEach(visitor func) const;
+        /**
+         * @brief evaluates the pipeline into a new list, with a copy of the list allocator
+         * @return SortedList<value_type> of the results
+         */
+        Results collect() const;
+    };
+
+    /**
+     * @brief starts a lazy pipeline over the list.
+     * example - view(list).filter(is_odd).apply(square).collect()
+     * @param list list to view, must outlive the view.
+     * @return view of the list elements as they are.
+     */
+    template <class T, class Alloc>
+    SortedListView<T, Alloc, SourceStage<T>, true> view(const SortedList<T, Alloc> &list)
+    {
+        return SortedListView<T, Alloc, SourceStage<T>, true>(list, SourceStage<T>());
+    }
+
+    /**
+     * @brief c`tor.
+     * @param list list to view.
+     * @param pipeline the stages to push the list elements through.
+     */
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    SortedListView<T, Alloc, Pipeline, Sorted>::SortedListView(const SortedList<T, Alloc> &list,
+                                                               const Pipeline &pipeline)
+        : list(&list), pipeline(pipeline) {}
+
+    /**
+     * @brief filter function, lazy.
+     * @param func filter function (boolean), called once per element when the view is used.
+     * @return new view with the filter added.
+     */
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    template <typename predict>
+    SortedListView<T, Alloc, FilterStage<Pipeline, predict>, Sorted>
+    SortedListView<T, Alloc, Pipeline, Sorted>::filter(predict func) const
+    {
+        return SortedListView<T, Alloc, FilterStage<Pipeline, predict>, Sorted>(
+            *list, FilterStage<Pipeline, predict>(pipeline, func));
+    }
+
+    /**
+     * @brief apply function, lazy.
+     * @param func apply function, called once per element when the view is used.
+     * @return new view with the apply added, not in order anymore.
+     */
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    template <typename function>
+    SortedListView<T, Alloc, ApplyStage<Pipeline, function>, false>
+    SortedListView<T, Alloc, Pipeline, Sorted>::apply(function func) const
+    {
+        return SortedListView<T, Alloc, ApplyStage<Pipeline, function>, false>(
+            *list, ApplyStage<Pipeline, function>(pipeline, func));
+    }
+
+    /**
+     * @brief apply function of an order preserving func, lazy.
+     * @param func apply function, called once per element when the view is used.
+     * @return new view with the apply added, in order if this view is.
+     */
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    template <typename function>
+    SortedListView<T, Alloc, ApplyStage<Pipeline, function>, Sorted>
+    SortedListView<T, Alloc, Pipeline, Sorted>::apply(function func, OrderPreserving) const
+    {
+        return SortedListView<T, Alloc, ApplyStage<Pipeline, function>, Sorted>(
+            *list, ApplyStage<Pipeline, function>(pipeline, func));
+    }
+
+    /**
+     * @brief forEach function.
+     * @param func called with every result, in sorted order.
+     */
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    template <typename visitor>
+    void SortedListView<T, Alloc, Pipeline, Sorted>::forEach(visitor func) const
+    {
+        forEach(func, std::integral_constant<bool, Sorted>());
+    }
+
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    template <typename visitor>
+    void SortedListView<T, Alloc, Pipeline, Sorted>::forEach(visitor &func, std::true_type) const
+    {
+        for (const T &element : *list)
+        {
+            pipeline.push(element, func);
+        }
+    }
+
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    template <typename visitor>
+    void SortedListView<T, Alloc, Pipeline, Sorted>::forEach(visitor &func, std::false_type) const
+    {
+        Results results = collect(std::false_type());
+        for (const value_type &result : results)
+        {
+            func(result);
+        }
+    }
+
+    /**
+     * @brief collect function.
+     * @return new list of the results.
+     */
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    typename SortedListView<T, Alloc, Pipeline, Sorted>::Results SortedListView<T, Alloc, Pipeline, Sorted>::collect() const
+    {
+        return collect(std::integral_constant<bool, Sorted>());
+    }
+
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    typename SortedListView<T, Alloc, Pipeline, Sorted>::Results
+    SortedListView<T, Alloc, Pipeline, Sorted>::collect(std::true_type) const
+    {
+        Results results((ResultAlloc(list->get_allocator())));
+        auto append = [&results](value_type result)
+        { results.insert(std::move(result)); };
+        for (const T &element : *list)
+        {
+            pipeline.push(element, append);
+        }
+        return results;
+    }
+
+    template <class T, class Alloc, class Pipeline, bool Sorted>
+    typename SortedListView<T, Alloc, Pipeline, Sorted>::Results
+    SortedListView<T, Alloc, Pipeline, Sorted>::collect(std::false_type) const
+    {
+        std::vector<value_type> results;
+        auto append = [&results](value_type result)
+        { results.push_back(std::move(result)); };
+        for (const T &element : *list)
+        {
+            pipeline.push(element, append);
+        }
+        return Results(std::make_move_iterator(results.begin()), std::make_move_iterator(results.end()),
+                       ResultAlloc(list->get_allocator()));
+    }
+}
+
+#endif
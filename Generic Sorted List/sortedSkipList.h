@@ -0,0 +1,831 @@
+#ifndef SORTED_SKIP_LIST_H
+#define SORTED_SKIP_LIST_H
+
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace mtm
+{
+
+    template <class T>
+    class SortedSkipList;
+
+    /*=======================================================================*/
+    /*========================== class SkipNode =============================*/
+    /*=======================================================================*/
+
+    template <class T>
+    class SkipNode
+    {
+        T data;
+        int height;
+        SkipNode<T> **levels;
+
+        /**
+         * @brief constructor with the node height and the data arguments, used only by create
+         * @param height number of levels the node is linked in
+         * @param args arguments forwarded to the T constructor
+         */
+        template <typename... Args>
+        explicit SkipNode(int height, Args &&...args);
+
+    public:
+        /**
+         * @brief delete the default constructor
+         * @param
+         */
+        SkipNode() = delete;
+        /**
+         * @brief nodes are never copied, they are owned by their list
+         * @param node
+         */
+        SkipNode(const SkipNode<T> &node) = delete;
+        /**
+         * @brief default destructor
+         * @param
+         */
+        ~SkipNode() = default;
+        SkipNode<T> &operator=(const SkipNode<T> &node) = delete;
+        /**
+         * @brief allocates the node and its levels array in one block and constructs the data in place
+         * @param height number of levels the node is linked in
+         * @param args arguments forwarded to the T constructor
+         * @return SkipNode<T>* the new node, with all its levels set to nullptr
+         */
+        template <typename... Args>
+        static SkipNode<T> *create(int height, Args &&...args);
+        /**
+         * @brief destructs the node and frees its block
+         * @param node
+         */
+        static void destroy(SkipNode<T> *node);
+        friend class SortedSkipList<T>;
+    };
+
+    template <class T>
+    template <typename... Args>
+    SkipNode<T>::SkipNode(int height, Args &&...args)
+        : data(std::forward<Args>(args)...), height(height),
+          levels(reinterpret_cast<SkipNode<T> **>(reinterpret_cast<char *>(this) + sizeof(SkipNode<T>)))
+    {
+        for (int i = 0; i < height; ++i)
+        {
+            levels[i] = nullptr;
+        }
+    }
+
+    template <class T>
+    template <typename... Args>
+    SkipNode<T> *SkipNode<T>::create(int height, Args &&...args)
+    {
+        void *block = ::operator new(sizeof(SkipNode<T>) + height * sizeof(SkipNode<T> *));
+        try
+        {
+            return new (block) SkipNode<T>(height, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            ::operator delete(block);
+            throw;
+        }
+    }
+
+    template <class T>
+    void SkipNode<T>::destroy(SkipNode<T> *node)
+    {
+        node->~SkipNode<T>();
+        ::operator delete(node);
+    }
+
+    /*=======================================================================*/
+    /*======================= class SortedSkipList ==========================*/
+    /*=======================================================================*/
+
+    /**
+     * @brief sorted list with the SortedList interface, kept as a skip list:
+     * every node is linked in level 0 and in a random number of express levels above it,
+     * so insert, remove by value lookups and lower_bound/find/contains are O(log n) on average.
+     * equal elements are kept in insertion order, like in SortedList.
+     */
+    template <class T>
+    class SortedSkipList
+    {
+        static const int MAX_HEIGHT = 16;
+
+        SkipNode<T> *heads[MAX_HEIGHT];
+        int height;
+        int size;
+        unsigned int seed;
+
+        /**
+         * @brief draws the height of a new node, each level with a quarter of the chance of the one below it
+         * @return int between 1 and MAX_HEIGHT
+         */
+        int randomHeight();
+        /**
+         * @brief links a new node after all the elements that are not bigger than it
+         * @param new_node
+         */
+        void link(SkipNode<T> *new_node);
+        /**
+         * @brief links the new node after the last node of each of its levels
+         * @param new_node node not smaller than the last element
+         * @param tails the next-pointer slots of the last node in each level, updated to the new node
+         */
+        void linkLast(SkipNode<T> *new_node, SkipNode<T> **tails[]);
+        /**
+         * @brief fills tails with the slots that linkLast appends to, for an empty list
+         * @param tails
+         */
+        void startAppend(SkipNode<T> **tails[]);
+        /**
+         * @brief deletes all the nodes of the list
+         */
+        void clear();
+
+    public:
+        class const_iterator;
+
+        /**
+         * @brief SortedSkipList constructor
+         */
+        SortedSkipList();
+        /**
+         * @brief SortedSkipList copy constructor, linear in the list length
+         * @param list
+         */
+        SortedSkipList(const SortedSkipList<T> &list);
+        /**
+         * @brief SortedSkipList move constructor, takes the nodes of list and leaves it empty
+         * @param list
+         */
+        SortedSkipList(SortedSkipList<T> &&list) noexcept;
+        /**
+         * @brief SortedSkipList destructor
+         */
+        ~SortedSkipList();
+        /**
+         * @brief SortedSkipList operator=
+         * @param list
+         * @return SortedSkipList<T>
+         */
+        SortedSkipList<T> &operator=(const SortedSkipList<T> &list);
+        /**
+         * @brief SortedSkipList move operator=, takes the nodes of list and leaves it empty
+         * @param list
+         * @return SortedSkipList<T>
+         */
+        SortedSkipList<T> &operator=(SortedSkipList<T> &&list) noexcept;
+
+        /**
+         * @brief insert a copy of the element to the list
+         * @param element
+         * @return true if success , false if doesn't
+         */
+        bool insert(const T &element);
+        /**
+         * @brief insert the element to the list by moving it into the new node
+         * @param element
+         * @return true if success , false if doesn't
+         */
+        bool insert(T &&element);
+        /**
+         * @brief insert new element to the list, constructed in place in the new node
+         * @param args arguments forwarded to the T constructor
+         * @return true if success , false if doesn't
+         */
+        template <typename... Args>
+        bool emplace(Args &&...args);
+        /**
+         * @brief remove element from the list, it must be an iterator of this list
+         * @param it
+         * @return const_iterator to the element that was after the removed one
+         */
+        const_iterator remove(const const_iterator &it);
+        /**
+         * @brief remove all the elements that func returns true for, in one pass
+         * @param func
+         * @return int number of removed elements
+         */
+        template <typename predict>
+        int remove_if(predict func);
+        /**
+         * @brief get the length of the list
+         * @return int length
+         */
+        int length() const;
+        /**
+         * @brief get the first iterator of the list
+         * @return const_iterator
+         */
+        const_iterator begin() const;
+        /**
+         * @brief get the last iterator of the list
+         * @return const_iterator
+         */
+        const_iterator end() const;
+        /**
+         * @brief find the first element that is not smaller than value
+         * @param value
+         * @return const_iterator to the element, end() if all the elements are smaller
+         */
+        const_iterator lower_bound(const T &value) const;
+        /**
+         * @brief find the first element equal to value (neither is smaller than the other)
+         * @param value
+         * @return const_iterator to the element, end() if there is no such element
+         */
+        const_iterator find(const T &value) const;
+        /**
+         * @brief check if there is an element equal to value in the list
+         * @param value
+         * @return true if there is , false if there isn't
+         */
+        bool contains(const T &value) const;
+
+        /**
+         * @brief filter the list with the predict func and return the filtered list
+         * @param func
+         * @return SortedSkipList<T> after the filter
+         */
+        template <typename predict>
+        SortedSkipList<T> filter(predict func) const;
+        /**
+         * @brief returns a new list after changes of the elements that made by the func function
+         * @param func
+         * @return SortedSkipList<T> after the apply
+         */
+        template <typename function>
+        SortedSkipList<T> apply(function func) const;
+    };
+
+    /**
+     * @brief default c`tor.
+     */
+    template <class T>
+    SortedSkipList<T>::SortedSkipList() : height(1), size(0), seed(0x9e3779b9u)
+    {
+        for (int i = 0; i < MAX_HEIGHT; ++i)
+        {
+            heads[i] = nullptr;
+        }
+    }
+
+    /**
+     * @brief copy c`tor, the nodes are appended in order.
+     * @param list list to copy.
+     */
+    template <class T>
+    SortedSkipList<T>::SortedSkipList(const SortedSkipList<T> &list) : SortedSkipList()
+    {
+        SkipNode<T> **tails[MAX_HEIGHT];
+        startAppend(tails);
+        for (SkipNode<T> *node = list.heads[0]; node != nullptr; node = node->levels[0])
+        {
+            linkLast(SkipNode<T>::create(randomHeight(), node->data), tails);
+        }
+    }
+
+    /**
+     * @brief move c`tor.
+     * @param list list to take the nodes from, left empty.
+     */
+    template <class T>
+    SortedSkipList<T>::SortedSkipList(SortedSkipList<T> &&list) noexcept
+        : height(list.height), size(list.size), seed(list.seed)
+    {
+        for (int i = 0; i < MAX_HEIGHT; ++i)
+        {
+            heads[i] = list.heads[i];
+            list.heads[i] = nullptr;
+        }
+        list.height = 1;
+        list.size = 0;
+    }
+
+    /**
+     * @brief d`tor.
+     */
+    template <class T>
+    SortedSkipList<T>::~SortedSkipList()
+    {
+        clear();
+    }
+
+    /**
+     * @brief deletes all the nodes, the list is left empty.
+     */
+    template <class T>
+    void SortedSkipList<T>::clear()
+    {
+        SkipNode<T> *node = heads[0];
+        while (node != nullptr)
+        {
+            SkipNode<T> *to_delete = node;
+            node = node->levels[0];
+            SkipNode<T>::destroy(to_delete);
+        }
+        for (int i = 0; i < MAX_HEIGHT; ++i)
+        {
+            heads[i] = nullptr;
+        }
+        height = 1;
+        size = 0;
+    }
+
+    /**
+     * @brief operator = for assigning.
+     * @param list list to assign.
+     * @return list copy to assign to this list.
+     */
+    template <class T>
+    SortedSkipList<T> &SortedSkipList<T>::operator=(const SortedSkipList<T> &list)
+    {
+        if (this == &list)
+        {
+            return *this;
+        }
+        SortedSkipList<T> copy(list);
+        return *this = std::move(copy);
+    }
+
+    /**
+     * @brief move operator = for assigning.
+     * @param list list to take the nodes from, left empty.
+     * @return this list, with the nodes of list.
+     */
+    template <class T>
+    SortedSkipList<T> &SortedSkipList<T>::operator=(SortedSkipList<T> &&list) noexcept
+    {
+        if (this == &list)
+        {
+            return *this;
+        }
+        clear();
+        for (int i = 0; i < MAX_HEIGHT; ++i)
+        {
+            heads[i] = list.heads[i];
+            list.heads[i] = nullptr;
+        }
+        height = list.height;
+        size = list.size;
+        list.height = 1;
+        list.size = 0;
+        return *this;
+    }
+
+    /**
+     * @brief xorshift step on the list seed, every two bits of luck add a level.
+     * @return height of the next node.
+     */
+    template <class T>
+    int SortedSkipList<T>::randomHeight()
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        int new_height = 1;
+        for (unsigned int bits = seed; (bits & 3) == 0 && new_height < MAX_HEIGHT; bits >>= 2)
+        {
+            new_height++;
+        }
+        return new_height;
+    }
+
+    /**
+     * @brief searches the place of the node from the top level down and links it in each of its levels.
+     * @param new_node node to link, owned by the list from now on.
+     */
+    template <class T>
+    void SortedSkipList<T>::link(SkipNode<T> *new_node)
+    {
+        const T &element = new_node->data;
+        if (new_node->height > height)
+        {
+            height = new_node->height;
+        }
+        SkipNode<T> **slot = nullptr;
+        SkipNode<T> *previous = nullptr;
+        for (int level = height - 1; level >= 0; --level)
+        {
+            slot = previous == nullptr ? &heads[level] : &previous->levels[level];
+            while (*slot != nullptr && !(element < (*slot)->data))
+            {
+                previous = *slot;
+                slot = &previous->levels[level];
+            }
+            if (level < new_node->height)
+            {
+                new_node->levels[level] = *slot;
+                *slot = new_node;
+            }
+        }
+        size++;
+    }
+
+    /**
+     * @brief appends the node at the end of each of its levels.
+     * @param new_node node to link, not smaller than the last element.
+     * @param tails slots to link at, updated to the slots of the new node.
+     */
+    template <class T>
+    void SortedSkipList<T>::linkLast(SkipNode<T> *new_node, SkipNode<T> **tails[])
+    {
+        if (new_node->height > height)
+        {
+            height = new_node->height;
+        }
+        for (int level = 0; level < new_node->height; ++level)
+        {
+            *tails[level] = new_node;
+            tails[level] = &new_node->levels[level];
+        }
+        size++;
+    }
+
+    /**
+     * @brief the slots to append at in an empty list are the heads.
+     * @param tails array of MAX_HEIGHT slots to fill.
+     */
+    template <class T>
+    void SortedSkipList<T>::startAppend(SkipNode<T> **tails[])
+    {
+        for (int level = 0; level < MAX_HEIGHT; ++level)
+        {
+            tails[level] = &heads[level];
+        }
+    }
+
+    /**
+     * @brief Insert funtion.
+     * @param element element to copy into the list.
+     * @return
+     */
+    template <class T>
+    bool SortedSkipList<T>::insert(const T &element)
+    {
+        return emplace(element);
+    }
+
+    /**
+     * @brief Insert funtion.
+     * @param element element to move into the list.
+     * @return
+     */
+    template <class T>
+    bool SortedSkipList<T>::insert(T &&element)
+    {
+        return emplace(std::move(element));
+    }
+
+    /**
+     * @brief Emplace funtion, the element is constructed once, directly in its node.
+     * @param args arguments for the element`s constructor.
+     * @return
+     */
+    template <class T>
+    template <typename... Args>
+    bool SortedSkipList<T>::emplace(Args &&...args)
+    {
+        link(SkipNode<T>::create(randomHeight(), std::forward<Args>(args)...));
+        return true;
+    }
+
+    /**
+     * @brief remove element with his iterator, the node is unlinked from each of its levels.
+     * @param it iterator pointing to the element to remove, must belong to this list.
+     * @return iterator to the next element (end() if the last element was removed).
+     * @exception out_of_range if it is end().
+     */
+    template <class T>
+    typename SortedSkipList<T>::const_iterator SortedSkipList<T>::remove(const const_iterator &it)
+    {
+        SkipNode<T> *target = it.node;
+        if (target == nullptr)
+        {
+            throw std::out_of_range("End of List");
+        }
+        SkipNode<T> *previous = nullptr;
+        for (int level = height - 1; level >= 0; --level)
+        {
+            SkipNode<T> **slot = previous == nullptr ? &heads[level] : &previous->levels[level];
+            while (*slot != nullptr && *slot != target && (*slot)->data < target->data)
+            {
+                previous = *slot;
+                slot = &previous->levels[level];
+            }
+            if (level < target->height)
+            {
+                while (*slot != target)
+                {
+                    slot = &(*slot)->levels[level];
+                }
+                *slot = target->levels[level];
+            }
+        }
+        SkipNode<T> *next = target->levels[0];
+        SkipNode<T>::destroy(target);
+        size--;
+        while (height > 1 && heads[height - 1] == nullptr)
+        {
+            height--;
+        }
+        return const_iterator(next);
+    }
+
+    /**
+     * @brief remove_if function, relinks the kept nodes of every level in one pass.
+     * @param func boolean function, the elements it returns true for are removed.
+     * @return number of removed elements.
+     */
+    template <class T>
+    template <typename predict>
+    int SortedSkipList<T>::remove_if(predict func)
+    {
+        SkipNode<T> **tails[MAX_HEIGHT];
+        startAppend(tails);
+        int removed = 0;
+        SkipNode<T> *node = heads[0];
+        while (node != nullptr)
+        {
+            SkipNode<T> *next = node->levels[0];
+            if (func(node->data))
+            {
+                SkipNode<T>::destroy(node);
+                removed++;
+            }
+            else
+            {
+                for (int level = 0; level < node->height; ++level)
+                {
+                    *tails[level] = node;
+                    tails[level] = &node->levels[level];
+                }
+            }
+            node = next;
+        }
+        for (int level = 0; level < MAX_HEIGHT; ++level)
+        {
+            *tails[level] = nullptr;
+        }
+        size -= removed;
+        while (height > 1 && heads[height - 1] == nullptr)
+        {
+            height--;
+        }
+        return removed;
+    }
+
+    /**
+     * @brief length function.
+     * @return length of the list (number of nodes\elements)
+     */
+    template <class T>
+    int SortedSkipList<T>::length() const
+    {
+        return size;
+    }
+
+    /**
+     * @return const_iterator to the beggining of the list
+     */
+    template <class T>
+    typename SortedSkipList<T>::const_iterator SortedSkipList<T>::begin() const
+    {
+        return const_iterator(heads[0]);
+    }
+
+    /**
+     * @return const_iterator to the end of the list (null).
+     */
+    template <class T>
+    typename SortedSkipList<T>::const_iterator SortedSkipList<T>::end() const
+    {
+        return const_iterator(nullptr);
+    }
+
+    /**
+     * @brief lower_bound function, goes down the levels skipping the smaller elements.
+     * @param value value to search.
+     * @return iterator to the first element that is not smaller than value.
+     */
+    template <class T>
+    typename SortedSkipList<T>::const_iterator SortedSkipList<T>::lower_bound(const T &value) const
+    {
+        SkipNode<T> *const *slot = nullptr;
+        SkipNode<T> *previous = nullptr;
+        for (int level = height - 1; level >= 0; --level)
+        {
+            slot = previous == nullptr ? &heads[level] : &previous->levels[level];
+            while (*slot != nullptr && (*slot)->data < value)
+            {
+                previous = *slot;
+                slot = &previous->levels[level];
+            }
+        }
+        return const_iterator(*slot);
+    }
+
+    /**
+     * @brief find function.
+     * @param value value to search.
+     * @return iterator to the first element equal to value, end() if not found.
+     */
+    template <class T>
+    typename SortedSkipList<T>::const_iterator SortedSkipList<T>::find(const T &value) const
+    {
+        const_iterator it = lower_bound(value);
+        if (it.node != nullptr && !(value < it.node->data))
+        {
+            return it;
+        }
+        return end();
+    }
+
+    /**
+     * @brief contains function.
+     * @param value value to search.
+     * @return true if an element equal to value is in the list.
+     */
+    template <class T>
+    bool SortedSkipList<T>::contains(const T &value) const
+    {
+        return find(value) != end();
+    }
+
+    /**
+     * @brief filter function, the kept elements are appended in order.
+     * @param func filter function to use when filtering the list (boolean)
+     * @return new list created by appling the filter on the current list.
+     */
+    template <class T>
+    template <typename predict>
+    SortedSkipList<T> SortedSkipList<T>::filter(predict func) const
+    {
+        SortedSkipList<T> new_list;
+        SkipNode<T> **tails[MAX_HEIGHT];
+        new_list.startAppend(tails);
+        for (SkipNode<T> *node = heads[0]; node != nullptr; node = node->levels[0])
+        {
+            if (func(node->data))
+            {
+                new_list.linkLast(SkipNode<T>::create(new_list.randomHeight(), node->data), tails);
+            }
+        }
+        return new_list;
+    }
+
+    /**
+     * @brief apply function.
+     * @param func apply function to edit the current elements of the list
+     * @return new list constructed with the apply function logic.
+     */
+    template <class T>
+    template <typename function>
+    SortedSkipList<T> SortedSkipList<T>::apply(function func) const
+    {
+        SortedSkipList<T> new_list;
+        for (SkipNode<T> *node = heads[0]; node != nullptr; node = node->levels[0])
+        {
+            new_list.insert(func(node->data));
+        }
+        return new_list;
+    }
+
+    /*=======================================================================*/
+    /*======================= class const_iterator ==========================*/
+    /*=======================================================================*/
+
+    template <class T>
+    class SortedSkipList<T>::const_iterator
+    {
+        SkipNode<T> *node;
+        /**
+         * @brief const_iterator constructor that get SkipNode<T>*
+         * @param node_new
+         */
+        const_iterator(SkipNode<T> *node_new) : node(node_new){};
+
+    public:
+        /**
+         * @brief The default constructor is deleted
+         * @param
+         */
+        const_iterator() = delete;
+        /**
+         * @brief const_iterator copy constructor
+         * @param iterator_new
+         */
+        const_iterator(const const_iterator &iterator_new) = default;
+        /**
+         * @brief default destructor
+         * @param
+         */
+        ~const_iterator() = default;
+        /**
+         * @brief const_iterator operator=
+         * @param iterator_new
+         * @return const_iterator&
+         */
+        const_iterator &operator=(const const_iterator &iterator_new) = default;
+        /**
+         * @brief const_iterator pre-fix operator ++
+         * @return const_iterator& with the ++ change
+         */
+        const_iterator &operator++();
+        /**
+         * @brief const_iterator post-fix operator ++
+         * @param dummy int parameter
+         * @return const_iterator& without the ++ change
+         */
+        const_iterator operator++(int);
+        /**
+         * @brief boolean operator== for const_iterator
+         * @param iterator_new
+         * @return true if identical , false if doesn't
+         */
+        bool operator==(const const_iterator &iterator_new) const;
+        /**
+         * @brief boolean operator!= for const_iterator
+         * @param iterator_new
+         * @return true if different , false if identical
+         */
+        bool operator!=(const const_iterator &iterator_new) const;
+        /**
+         * @brief operator* for const_iterator
+         * @return the T data of the iterator
+         */
+        const T &operator*() const;
+        friend class SortedSkipList<T>;
+    };
+
+    /**
+     * @brief prefix ++ operator, advancing the iterator one element forward.
+     * @return iterator to the next element.
+     * @exception out_of_range if the current iterator is the last one.
+     */
+    template <class T>
+    typename SortedSkipList<T>::const_iterator &SortedSkipList<T>::const_iterator::operator++()
+    {
+        if (this->node == nullptr)
+        {
+            throw std::out_of_range("End of List");
+        }
+        this->node = this->node->levels[0];
+        return *this;
+    }
+
+    /**
+     * @brief postfix ++ operator, advancing the iterator one element forward.
+     * @return the original iterator
+     * @exception out_of_range if the current iterator is the last one.
+     */
+    template <class T>
+    typename SortedSkipList<T>::const_iterator SortedSkipList<T>::const_iterator::operator++(int)
+    {
+        const_iterator temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    /**
+     * @brief == operator compares the nodes of the iterators
+     * @param iterator_new iterator to compare with
+     * @return true if the same, false else.
+     */
+    template <class T>
+    bool SortedSkipList<T>::const_iterator::operator==(const const_iterator &iterator_new) const
+    {
+        return this->node == iterator_new.node;
+    }
+
+    /**
+     * @brief != operator, the opposite of ==
+     * @param iterator_new iterator to compare with
+     * @return true if different, false else.
+     */
+    template <class T>
+    bool SortedSkipList<T>::const_iterator::operator!=(const const_iterator &iterator_new) const
+    {
+        return this->node != iterator_new.node;
+    }
+
+    /**
+     * @brief derefrencing operator.
+     * @return data of the node pointed to by the iterator.
+     * @exception out_of_range if the iterator is end().
+     */
+    template <class T>
+    const T &SortedSkipList<T>::const_iterator::operator*() const
+    {
+        if (this->node == nullptr)
+        {
+            throw std::out_of_range("Out of range");
+        }
+        return this->node->data;
+    }
+}
+
+#endif
@@ -0,0 +1,42 @@
+#include "stringPool.h"
+
+#include <utility>
+
+namespace mtm
+{
+    /**
+     * @brief looks the string up first, so a string that is already interned is not copied.
+     * @param string string to intern.
+     * @return refrence to the pool copy.
+     */
+    const std::string &StringPool::intern(const std::string &string)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        std::unordered_set<std::string>::const_iterator found = strings.find(string);
+        if (found != strings.end())
+        {
+            return *found;
+        }
+        return *strings.insert(string).first;
+    }
+
+    /**
+     * @brief like intern of a const string, a new string is moved into the pool.
+     * @param string string to intern.
+     * @return refrence to the pool copy.
+     */
+    const std::string &StringPool::intern(std::string &&string)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return *strings.insert(std::move(string)).first;
+    }
+
+    /**
+     * @return number of distinct strings.
+     */
+    int StringPool::size() const
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return (int)strings.size();
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef STRING_POOL_H_
+#define STRING_POOL_H_
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+namespace mtm
+{
+    /**
+     * @brief interning table of strings, every distinct string is kept once and equal strings
+     * share it, so holders keep a refrence instead of a copy.
+     * the interned strings are never removed and their refrences stay valid as long as the pool.
+     * so the pool only grows: its memory is that of every distinct string ever interned, even after
+     * nothing refers to it anymore. it fits a bounded set of strings (like the exam links of a term),
+     * not a stream of always new strings.
+     * intern is thread safe, reading an interned string needs no lock.
+     */
+    class StringPool
+    {
+        std::unordered_set<std::string> strings;
+        mutable std::mutex lock;
+
+    public:
+        /**
+         * @brief empty pool
+         */
+        StringPool() = default;
+        StringPool(const StringPool &pool) = delete;
+        StringPool &operator=(const StringPool &pool) = delete;
+        ~StringPool() = default;
+
+        /**
+         * @brief finds the pool copy of the string, adding it if it is new
+         * @param string
+         * @return const std::string& the shared copy
+         */
+        const std::string &intern(const std::string &string);
+        /**
+         * @brief finds the pool copy of the string, moving it into the pool if it is new
+         * @param string
+         * @return const std::string& the shared copy
+         */
+        const std::string &intern(std::string &&string);
+        /**
+         * @return number of distinct strings in the pool
+         */
+        int size() const;
+    };
+}
+
+#endif